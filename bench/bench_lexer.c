@@ -0,0 +1,59 @@
+// bench_lexer.c
+// Mide el rendimiento del lexer (tokens/s y MB/s) sobre un archivo Mini-0.
+//
+// Uso: bench_lexer <archivo.mini0> [repeticiones]
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../src/lexer.h"
+#include "../src/source.h"
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Uso: %s <archivo.mini0> [repeticiones]\n", argv[0]);
+        return 1;
+    }
+    
+    size_t length = 0;
+    char* source = read_file(argv[1], &length);
+    if (source == NULL) return 1;
+    
+    int repetitions = argc > 2 ? atoi(argv[2]) : 10;
+    if (repetitions < 1) repetitions = 1;
+    
+    unsigned long tokens = 0;
+    double best = 0.0;
+    
+    // Se reporta la mejor repeticion para reducir el ruido
+    for (int r = 0; r < repetitions; r++) {
+        Lexer lexer;
+        lexer_init(&lexer, source);
+        lexer.padded = 1;
+        tokens = 0;
+        
+        double t0 = now_seconds();
+        for (;;) {
+            Token token = lexer_next_token(&lexer);
+            TokenType type = token.type;
+            token_free(&token);
+            tokens++;
+            if (type == TOKEN_EOF) break;
+        }
+        double elapsed = now_seconds() - t0;
+        
+        if (r == 0 || elapsed < best) best = elapsed;
+    }
+    
+    printf("%lu tokens, %zu bytes, %.3f ms\n", tokens, length, best * 1000.0);
+    printf("%.2f Mtokens/s, %.1f MB/s\n",
+           tokens / best / 1e6, length / best / 1e6);
+    
+    free(source);
+    return 0;
+}
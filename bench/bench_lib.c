@@ -0,0 +1,104 @@
+// bench_lib.c
+// Mide el rendimiento de libmini0 (mini0_check) con fuentes pequeños,
+// con 1 hilo y con N hilos que analizan en paralelo.
+//
+// Uso: bench_lib [archivo.mini0] [hilos] [analisis_por_hilo]
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../src/mini0.h"
+#include "../src/source.h"
+
+// Fuente de ejemplo si no se pasa un archivo (del README)
+static const char* default_snippet =
+    "fun factorial(n: int): int\n"
+    "    result: int\n"
+    "    if n <= 1\n"
+    "        result = 1\n"
+    "    else\n"
+    "        result = n * factorial(n - 1)\n"
+    "    end\n"
+    "    return result\n"
+    "end\n";
+
+typedef struct {
+    const char* source;
+    size_t length;
+    int iterations;
+    int failures;
+} Worker;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void* run_worker(void* argument) {
+    Worker* worker = (Worker*)argument;
+    
+    for (int i = 0; i < worker->iterations; i++) {
+        Mini0Result* result = mini0_check(worker->source, worker->length);
+        if (result == NULL || !mini0_result_ok(result)) worker->failures++;
+        mini0_result_free(result);
+    }
+    
+    return NULL;
+}
+
+int main(int argc, char* argv[]) {
+    size_t length = strlen(default_snippet);
+    char* file = NULL;
+    const char* source = default_snippet;
+    
+    if (argc > 1) {
+        file = read_file(argv[1], &length);
+        if (file == NULL) return 1;
+        source = file;
+    }
+    
+    int max_threads = argc > 2 ? atoi(argv[2]) : 4;
+    if (max_threads < 1) max_threads = 1;
+    
+    int iterations = argc > 3 ? atoi(argv[3]) : 200000;
+    if (iterations < 1) iterations = 1;
+    
+    printf("Fuente de %zu bytes, %d analisis por hilo\n", length, iterations);
+    
+    pthread_t* threads = (pthread_t*)malloc(sizeof(pthread_t) * max_threads);
+    Worker* workers = (Worker*)malloc(sizeof(Worker) * max_threads);
+    
+    int counts[2] = {1, max_threads};
+    for (int c = 0; c < 2; c++) {
+        int count = counts[c];
+        if (c == 1 && count == 1) break;
+        
+        double t0 = now_seconds();
+        for (int i = 0; i < count; i++) {
+            workers[i].source = source;
+            workers[i].length = length;
+            workers[i].iterations = iterations;
+            workers[i].failures = 0;
+            pthread_create(&threads[i], NULL, run_worker, &workers[i]);
+        }
+        
+        int failures = 0;
+        for (int i = 0; i < count; i++) {
+            pthread_join(threads[i], NULL);
+            failures += workers[i].failures;
+        }
+        double elapsed = now_seconds() - t0;
+        
+        double total = (double)count * iterations;
+        printf("%2d hilo(s): %10.0f analisis/s, %6.2f us por analisis%s\n",
+               count, total / elapsed, elapsed * 1e6 / iterations,
+               failures > 0 ? " (con errores)" : "");
+    }
+    
+    free(workers);
+    free(threads);
+    free(file);
+    return 0;
+}
@@ -0,0 +1,97 @@
+// bench_parser.c
+// Mide el costo del parser, incluida la recuperacion de errores, sobre un
+// archivo Mini-0 replicado 1 y N veces: si el costo es lineal, los MB/s
+// de ambas mediciones deben ser parecidos.
+//
+// Uso: bench_parser <archivo.mini0> [factor] [repeticiones]
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../src/lexer.h"
+#include "../src/parser.h"
+#include "../src/source.h"
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+// Mejor tiempo de parser_parse sobre 'source'; los diagnosticos se
+// guardan en memoria para no medir la escritura en stderr
+static double parse_best(const char* source, int repetitions, int* error_count) {
+    double best = 0.0;
+    
+    for (int r = 0; r < repetitions; r++) {
+        Lexer lexer;
+        lexer_init(&lexer, source);
+        lexer.padded = 1;
+        
+        Diagnostics diagnostics;
+        diagnostics_init(&diagnostics);
+        
+        Parser parser;
+        parser_init(&parser, &lexer);
+        parser.diagnostics = &diagnostics;
+        
+        double t0 = now_seconds();
+        parser_parse(&parser);
+        double elapsed = now_seconds() - t0;
+        
+        *error_count = parser.error_count;
+        parser_free(&parser);
+        diagnostics_free(&diagnostics);
+        
+        if (r == 0 || elapsed < best) best = elapsed;
+    }
+    
+    return best;
+}
+
+static void report(const char* label, size_t length, double seconds, int errors) {
+    printf("%-4s %10zu bytes %8d errores %10.3f ms %8.1f MB/s\n",
+           label, length, errors, seconds * 1000.0, length / seconds / 1e6);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Uso: %s <archivo.mini0> [factor] [repeticiones]\n", argv[0]);
+        return 1;
+    }
+    
+    size_t length = 0;
+    char* source = read_file(argv[1], &length);
+    if (source == NULL) return 1;
+    
+    int factor = argc > 2 ? atoi(argv[2]) : 10;
+    if (factor < 1) factor = 1;
+    
+    int repetitions = argc > 3 ? atoi(argv[3]) : 5;
+    if (repetitions < 1) repetitions = 1;
+    
+    char* scaled = (char*)malloc(length * factor + 1 + SIMD_PAD);
+    if (scaled == NULL) {
+        free(source);
+        return 1;
+    }
+    for (int i = 0; i < factor; i++) {
+        memcpy(scaled + length * i, source, length);
+    }
+    memset(scaled + length * factor, 0, 1 + SIMD_PAD);
+    
+    int errors = 0;
+    double t1 = parse_best(source, repetitions, &errors);
+    report("x1", length, t1, errors);
+    
+    char label[16];
+    snprintf(label, sizeof(label), "x%d", factor);
+    double tn = parse_best(scaled, repetitions, &errors);
+    report(label, length * factor, tn, errors);
+    
+    printf("Crecimiento: %.2f (lineal = 1.00)\n", tn / (t1 * factor));
+    
+    free(scaled);
+    free(source);
+    return 0;
+}
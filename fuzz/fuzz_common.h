@@ -0,0 +1,90 @@
+#ifndef FUZZ_COMMON_H
+#define FUZZ_COMMON_H
+
+// Utilidades compartidas por los harness de fuzzing (libFuzzer / AFL).
+// Todo corre en memoria: la entrada del fuzzer se copia a un buffer
+// terminado en '\0', que es lo que esperan lexer_init y read_file.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../src/lexer.h"
+
+// Veces que se replica la entrada para medir el crecimiento del tiempo
+#define FUZZ_SCALE_FACTOR 8
+
+// Tolerancia: tiempo(entrada x8) puede ser hasta 4 veces lo lineal
+#define FUZZ_SUPERLINEAR_RATIO 4.0
+
+// Por debajo de este tiempo la medicion es puro ruido
+#define FUZZ_MIN_MEASURABLE_NS 20000.0
+
+// Presupuesto absoluto: costo fijo + costo por byte (MINI0_FUZZ_NS_PER_BYTE)
+#define FUZZ_BASE_BUDGET_NS 5000000.0
+#define FUZZ_DEFAULT_NS_PER_BYTE 1000.0
+
+typedef void (*FuzzRunFn)(const char* source, size_t size);
+
+static double fuzz_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// Copia 'times' veces la entrada en un buffer nuevo terminado en '\0' y
+// con SIMD_PAD bytes reservados después (como read_file)
+static char* fuzz_make_source(const uint8_t* data, size_t size, int times) {
+    char* source = (char*)malloc(size * times + 1 + SIMD_PAD);
+    if (source == NULL) abort();
+    
+    for (int i = 0; i < times; i++) {
+        memcpy(source + size * i, data, size);
+    }
+    memset(source + size * times, 0, 1 + SIMD_PAD);
+    
+    return source;
+}
+
+static double fuzz_time_run(FuzzRunFn run, const char* source, size_t size) {
+    double t0 = fuzz_now_ns();
+    run(source, size);
+    return fuzz_now_ns() - t0;
+}
+
+static double fuzz_ns_per_byte(void) {
+    const char* env = getenv("MINI0_FUZZ_NS_PER_BYTE");
+    if (env != NULL && atof(env) > 0.0) return atof(env);
+    return FUZZ_DEFAULT_NS_PER_BYTE;
+}
+
+// Ejecuta 'run' sobre la entrada y marca como fallo (abort) las entradas
+// cuyo tiempo excede un presupuesto lineal o crece superlinealmente al
+// replicar la entrada FUZZ_SCALE_FACTOR veces.
+static void fuzz_run_checked(FuzzRunFn run, const uint8_t* data, size_t size) {
+    char* source = fuzz_make_source(data, size, 1);
+    double t1 = fuzz_time_run(run, source, size);
+    free(source);
+    
+    double budget = FUZZ_BASE_BUDGET_NS + fuzz_ns_per_byte() * (double)size;
+    if (t1 > budget) {
+        fprintf(stderr, "fuzz: %zu bytes tardaron %.0f ns (presupuesto %.0f ns)\n",
+                size, t1, budget);
+        abort();
+    }
+    
+    if (t1 < FUZZ_MIN_MEASURABLE_NS) return;
+    
+    char* scaled = fuzz_make_source(data, size, FUZZ_SCALE_FACTOR);
+    double tk = fuzz_time_run(run, scaled, size * FUZZ_SCALE_FACTOR);
+    free(scaled);
+    
+    if (tk > t1 * FUZZ_SCALE_FACTOR * FUZZ_SUPERLINEAR_RATIO) {
+        fprintf(stderr, "fuzz: tiempo superlineal: %zu bytes -> %.0f ns, "
+                "x%d -> %.0f ns\n", size, t1, FUZZ_SCALE_FACTOR, tk);
+        abort();
+    }
+}
+
+#endif
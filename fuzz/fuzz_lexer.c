@@ -0,0 +1,31 @@
+// fuzz_lexer.c
+// Harness de fuzzing para lexer_next_token.
+#include "fuzz_common.h"
+#include "../src/lexer.h"
+
+static void run_lexer(const char* source, size_t size) {
+    Lexer lexer;
+    lexer_init(&lexer, source);
+    lexer.padded = 1;
+    lexer.end = source + size;
+    
+    // Cada token consume al menos un byte: si hay mas tokens que bytes
+    // el lexer dejo de avanzar
+    size_t count = 0;
+    for (;;) {
+        Token token = lexer_next_token(&lexer);
+        TokenType type = token.type;
+        token_free(&token);
+        
+        if (type == TOKEN_EOF) break;
+        if (++count > size + 1) {
+            fprintf(stderr, "fuzz: el lexer no avanza\n");
+            abort();
+        }
+    }
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    fuzz_run_checked(run_lexer, data, size);
+    return 0;
+}
@@ -0,0 +1,29 @@
+// fuzz_parser.c
+// Harness de fuzzing para parser_parse.
+#include "fuzz_common.h"
+#include "../src/lexer.h"
+#include "../src/parser.h"
+
+static void run_parser(const char* source, size_t size) {
+    Lexer lexer;
+    lexer_init(&lexer, source);
+    lexer.padded = 1;
+    lexer.end = source + size;
+    
+    // Diagnosticos en memoria: con la recuperacion de errores una entrada
+    // puede reportar muchos, y escribirlos en stderr dominaria la medicion
+    Diagnostics diagnostics;
+    diagnostics_init(&diagnostics);
+    
+    Parser parser;
+    parser_init(&parser, &lexer);
+    parser.diagnostics = &diagnostics;
+    parser_parse(&parser);
+    parser_free(&parser);
+    diagnostics_free(&diagnostics);
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    fuzz_run_checked(run_parser, data, size);
+    return 0;
+}
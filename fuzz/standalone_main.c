@@ -0,0 +1,52 @@
+// standalone_main.c
+// Driver para AFL y para reproducir casos sin libFuzzer: ejecuta el
+// harness enlazado sobre cada archivo recibido (o sobre stdin).
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+static int run_stream(FILE* file) {
+    size_t capacity = 4096;
+    size_t size = 0;
+    uint8_t* data = (uint8_t*)malloc(capacity);
+    if (data == NULL) return 1;
+    
+    size_t n;
+    while ((n = fread(data + size, 1, capacity - size, file)) > 0) {
+        size += n;
+        if (size == capacity) {
+            capacity *= 2;
+            uint8_t* grown = (uint8_t*)realloc(data, capacity);
+            if (grown == NULL) {
+                free(data);
+                return 1;
+            }
+            data = grown;
+        }
+    }
+    
+    LLVMFuzzerTestOneInput(data, size);
+    free(data);
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        return run_stream(stdin);
+    }
+    
+    for (int i = 1; i < argc; i++) {
+        FILE* file = fopen(argv[i], "rb");
+        if (file == NULL) {
+            fprintf(stderr, "Error: No se pudo abrir el archivo '%s'\n", argv[i]);
+            return 1;
+        }
+        int status = run_stream(file);
+        fclose(file);
+        if (status != 0) return status;
+    }
+    
+    return 0;
+}
@@ -0,0 +1,83 @@
+// arena.c
+#include "arena.h"
+#include <stdlib.h>
+
+#define ARENA_ALIGN 8
+
+void arena_init(Arena* arena) {
+    arena->first = NULL;
+    arena->current = NULL;
+}
+
+static ArenaChunk* new_chunk(size_t size) {
+    ArenaChunk* chunk = (ArenaChunk*)malloc(sizeof(ArenaChunk) + size);
+    if (chunk == NULL) return NULL;
+    
+    chunk->next = NULL;
+    chunk->size = size;
+    chunk->used = 0;
+    return chunk;
+}
+
+void* arena_alloc(Arena* arena, size_t size) {
+    size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+    
+    // Usar el bloque actual o alguno de los siguientes ya reservados
+    ArenaChunk* chunk = arena->current;
+    while (chunk != NULL) {
+        if (chunk->size - chunk->used >= size) {
+            void* pointer = chunk->data + chunk->used;
+            chunk->used += size;
+            arena->current = chunk;
+            return pointer;
+        }
+        chunk = chunk->next;
+    }
+    
+    size_t chunk_size = size > ARENA_CHUNK_SIZE ? size : ARENA_CHUNK_SIZE;
+    chunk = new_chunk(chunk_size);
+    if (chunk == NULL) return NULL;
+    
+    // El bloque nuevo va después del actual
+    if (arena->current == NULL) {
+        chunk->next = arena->first;
+        arena->first = chunk;
+    } else {
+        chunk->next = arena->current->next;
+        arena->current->next = chunk;
+    }
+    
+    arena->current = chunk;
+    chunk->used = size;
+    return chunk->data;
+}
+
+void arena_reset(Arena* arena) {
+    size_t retained = 0;
+    ArenaChunk** link = &arena->first;
+    
+    while (*link != NULL) {
+        ArenaChunk* chunk = *link;
+        if (retained + chunk->size > ARENA_MAX_RETAINED) {
+            *link = chunk->next;
+            free(chunk);
+            continue;
+        }
+        
+        retained += chunk->size;
+        chunk->used = 0;
+        link = &chunk->next;
+    }
+    
+    arena->current = arena->first;
+}
+
+void arena_free(Arena* arena) {
+    ArenaChunk* chunk = arena->first;
+    while (chunk != NULL) {
+        ArenaChunk* next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    arena_init(arena);
+}
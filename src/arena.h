@@ -0,0 +1,39 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+// Arena de memoria por bloques: las reservas avanzan un puntero dentro del
+// bloque actual y se liberan todas juntas con arena_reset. Los bloques se
+// conservan entre usos para no volver a pedir memoria en cada análisis.
+
+#define ARENA_CHUNK_SIZE (64 * 1024)
+
+// Memoria máxima que arena_reset conserva; los bloques que excedan este
+// total (por ejemplo tras un fuente muy grande) se liberan
+#define ARENA_MAX_RETAINED (1024 * 1024)
+
+typedef struct ArenaChunk {
+    struct ArenaChunk* next;
+    size_t size;
+    size_t used;
+    char data[];
+} ArenaChunk;
+
+typedef struct {
+    ArenaChunk* first;
+    ArenaChunk* current;
+} Arena;
+
+void arena_init(Arena* arena);
+
+// Reservar 'size' bytes alineados a 8. Retorna NULL si no hay memoria.
+void* arena_alloc(Arena* arena, size_t size);
+
+// Liberar todas las reservas (conserva hasta ARENA_MAX_RETAINED bytes)
+void arena_reset(Arena* arena);
+
+// Liberar todos los bloques
+void arena_free(Arena* arena);
+
+#endif
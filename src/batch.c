@@ -0,0 +1,274 @@
+// batch.c
+#include "batch.h"
+#include "mini0.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <time.h>
+#endif
+
+// Escribir el resultado de un archivo. Retorna 1 si tuvo errores.
+static int report(const char* path, LoadStatus status, const Mini0Result* result) {
+    switch (status) {
+        case LOAD_OPEN_FAILED:
+            fprintf(stderr, "Error: No se pudo abrir el archivo '%s'\n", path);
+            return 1;
+        case LOAD_READ_FAILED:
+            fprintf(stderr, "Error: No se pudo leer el archivo '%s'\n", path);
+            return 1;
+        case LOAD_NO_MEMORY:
+            fprintf(stderr, "Error: No hay memoria suficiente para leer '%s'\n", path);
+            return 1;
+        case LOAD_OK:
+            break;
+    }
+    
+    if (result == NULL) {
+        fprintf(stderr, "Error: No hay memoria suficiente para analizar '%s'\n", path);
+        return 1;
+    }
+    if (mini0_result_ok(result)) {
+        printf("%s: Analisis sintactico exitoso!\n", path);
+        return 0;
+    }
+    
+    // Cada línea de diagnóstico con la ruta como prefijo
+    size_t length = 0;
+    const char* text = mini0_result_diagnostics(result, &length);
+    const char* end = text + length;
+    while (text < end) {
+        const char* newline = (const char*)memchr(text, '\n', (size_t)(end - text));
+        const char* line_end = newline != NULL ? newline + 1 : end;
+        fprintf(stderr, "%s: %.*s", path, (int)(line_end - text), text);
+        text = line_end;
+    }
+    return 1;
+}
+
+static void print_summary(int count, int failed) {
+    printf("%d archivos analizados: %d correctos, %d con errores\n",
+           count, count - failed, failed);
+}
+
+#ifdef _WIN32
+
+// Sin hilos: cada archivo se analiza y reporta al cargarlo
+
+typedef struct {
+    char** paths;
+    int failed;
+} SyncBatch;
+
+static void deliver_sync(void* context, LoadedFile* file) {
+    SyncBatch* batch = (SyncBatch*)context;
+    Mini0Result* result = NULL;
+    if (file->status == LOAD_OK) {
+        result = mini0_check(file->data, file->length);
+        free(file->data);
+    }
+    batch->failed += report(batch->paths[file->index], file->status, result);
+    mini0_result_free(result);
+}
+
+int batch_check(char** paths, int count, LoaderKind loader, int workers, int show_stats) {
+    (void)loader;
+    (void)workers;
+    (void)show_stats;
+    
+    SyncBatch batch;
+    batch.paths = paths;
+    batch.failed = 0;
+    loader_run(LOADER_SYNC, paths, count, deliver_sync, &batch);
+    
+    print_summary(count, batch.failed);
+    return batch.failed;
+}
+
+#else
+
+// Resultado de un archivo, escrito por un hilo de análisis
+typedef struct {
+    LoadStatus status;
+    Mini0Result* result;
+    int ready;
+} BatchSlot;
+
+typedef struct {
+    char** paths;
+    int count;
+    LoaderKind loader;
+    
+    // Archivos leídos que esperan análisis (cola circular)
+    LoadedFile queue[BATCH_QUEUE_LENGTH];
+    int queue_head;
+    int queue_length;
+    int loading_done;
+    
+    BatchSlot* slots;
+    size_t bytes;
+    
+    pthread_mutex_t mutex;
+    pthread_cond_t queue_changed;
+    pthread_cond_t slot_ready;
+} Batch;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+// LoaderDeliver: encolar un archivo leído (espera si la cola está llena)
+static void deliver(void* context, LoadedFile* file) {
+    Batch* batch = (Batch*)context;
+    
+    pthread_mutex_lock(&batch->mutex);
+    while (batch->queue_length == BATCH_QUEUE_LENGTH) {
+        pthread_cond_wait(&batch->queue_changed, &batch->mutex);
+    }
+    int position = (batch->queue_head + batch->queue_length) % BATCH_QUEUE_LENGTH;
+    batch->queue[position] = *file;
+    batch->queue_length++;
+    batch->bytes += file->length;
+    pthread_cond_broadcast(&batch->queue_changed);
+    pthread_mutex_unlock(&batch->mutex);
+}
+
+static void* loader_thread(void* argument) {
+    Batch* batch = (Batch*)argument;
+    LoaderKind used = loader_run(batch->loader, batch->paths, batch->count, deliver, batch);
+    
+    pthread_mutex_lock(&batch->mutex);
+    batch->loader = used;
+    batch->loading_done = 1;
+    pthread_cond_broadcast(&batch->queue_changed);
+    pthread_mutex_unlock(&batch->mutex);
+    return NULL;
+}
+
+static void* worker_thread(void* argument) {
+    Batch* batch = (Batch*)argument;
+    
+    for (;;) {
+        pthread_mutex_lock(&batch->mutex);
+        while (batch->queue_length == 0 && !batch->loading_done) {
+            pthread_cond_wait(&batch->queue_changed, &batch->mutex);
+        }
+        if (batch->queue_length == 0) {
+            pthread_mutex_unlock(&batch->mutex);
+            break;
+        }
+        LoadedFile file = batch->queue[batch->queue_head];
+        batch->queue_head = (batch->queue_head + 1) % BATCH_QUEUE_LENGTH;
+        batch->queue_length--;
+        pthread_cond_broadcast(&batch->queue_changed);
+        pthread_mutex_unlock(&batch->mutex);
+        
+        Mini0Result* result = NULL;
+        if (file.status == LOAD_OK) {
+            result = mini0_check(file.data, file.length);
+            free(file.data);
+        }
+        
+        pthread_mutex_lock(&batch->mutex);
+        BatchSlot* slot = &batch->slots[file.index];
+        slot->status = file.status;
+        slot->result = result;
+        slot->ready = 1;
+        pthread_cond_broadcast(&batch->slot_ready);
+        pthread_mutex_unlock(&batch->mutex);
+    }
+    
+    return NULL;
+}
+
+static void batch_free(Batch* batch, pthread_t* threads) {
+    pthread_cond_destroy(&batch->slot_ready);
+    pthread_cond_destroy(&batch->queue_changed);
+    pthread_mutex_destroy(&batch->mutex);
+    free(batch->slots);
+    free(batch);
+    free(threads);
+}
+
+int batch_check(char** paths, int count, LoaderKind loader, int workers, int show_stats) {
+    if (workers < 1) workers = 1;
+    
+    Batch* batch = (Batch*)calloc(1, sizeof(Batch));
+    pthread_t* threads = (pthread_t*)malloc(sizeof(pthread_t) * (size_t)(workers + 1));
+    if (batch != NULL) batch->slots = (BatchSlot*)calloc((size_t)count + 1, sizeof(BatchSlot));
+    if (batch == NULL || threads == NULL || batch->slots == NULL) {
+        if (batch != NULL) free(batch->slots);
+        free(batch);
+        free(threads);
+        return BATCH_NO_MEMORY;
+    }
+    
+    batch->paths = paths;
+    batch->count = count;
+    batch->loader = loader;
+    pthread_mutex_init(&batch->mutex, NULL);
+    pthread_cond_init(&batch->queue_changed, NULL);
+    pthread_cond_init(&batch->slot_ready, NULL);
+    
+    double t0 = now_seconds();
+    
+    // Primero los hilos de análisis: sin ninguno, el cargador quedaría
+    // esperando con la cola llena. Con menos de 'workers' se sigue igual.
+    int started = 0;
+    while (started < workers &&
+           pthread_create(&threads[started + 1], NULL, worker_thread, batch) == 0) {
+        started++;
+    }
+    
+    if (started == 0 || pthread_create(&threads[0], NULL, loader_thread, batch) != 0) {
+        // Sin cargador no llega nada: los hilos iniciados terminan al ver
+        // la carga cerrada
+        pthread_mutex_lock(&batch->mutex);
+        batch->loading_done = 1;
+        pthread_cond_broadcast(&batch->queue_changed);
+        pthread_mutex_unlock(&batch->mutex);
+        
+        for (int i = 1; i <= started; i++) {
+            pthread_join(threads[i], NULL);
+        }
+        batch_free(batch, threads);
+        return BATCH_NO_THREADS;
+    }
+    
+    // Resultados en el orden de la lista
+    int failed = 0;
+    for (int i = 0; i < count; i++) {
+        pthread_mutex_lock(&batch->mutex);
+        while (!batch->slots[i].ready) {
+            pthread_cond_wait(&batch->slot_ready, &batch->mutex);
+        }
+        BatchSlot slot = batch->slots[i];
+        pthread_mutex_unlock(&batch->mutex);
+        
+        failed += report(paths[i], slot.status, slot.result);
+        mini0_result_free(slot.result);
+    }
+    
+    for (int i = 0; i <= started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    
+    double elapsed = now_seconds() - t0;
+    print_summary(count, failed);
+    if (show_stats) {
+        fprintf(stderr, "Estadisticas de --batch:\n");
+        fprintf(stderr, "  cargador: %s, %d hilo(s) de analisis\n",
+                loader_name(batch->loader), started);
+        fprintf(stderr, "  %d archivos, %.1f MB en %.3f ms\n",
+                count, (double)batch->bytes / (1024.0 * 1024.0), elapsed * 1000.0);
+    }
+    
+    batch_free(batch, threads);
+    return failed;
+}
+
+#endif
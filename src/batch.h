@@ -0,0 +1,28 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "loader.h"
+
+// Validación por lotes (--batch): analiza todos los archivos de una lista.
+// Un cargador (loader.h) lee muchos archivos a la vez y entrega cada uno
+// en cuanto termina de leerse a 'workers' hilos que lo analizan con
+// mini0_check, mientras el hilo principal escribe los resultados en el
+// orden de la lista.
+//
+// Cada archivo produce las mismas líneas que su análisis por separado,
+// con la ruta como prefijo ("ruta: [Linea 3, Columna 1] Error ..." en
+// stderr, "ruta: Analisis sintactico exitoso!" en stdout), y al final se
+// escribe un resumen en stdout.
+
+// Máximo de archivos leídos que esperan análisis (limita la memoria)
+#define BATCH_QUEUE_LENGTH 256
+
+// Errores que impiden iniciar el lote (no se escribe nada)
+#define BATCH_NO_MEMORY -1
+#define BATCH_NO_THREADS -2
+
+// Retorna el número de archivos con errores, o BATCH_NO_MEMORY /
+// BATCH_NO_THREADS
+int batch_check(char** paths, int count, LoaderKind loader, int workers, int show_stats);
+
+#endif
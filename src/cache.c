@@ -0,0 +1,267 @@
+// cache.c
+#include "cache.h"
+#include "parser.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#define getpid _getpid
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define CACHE_MAGIC "M0TC"
+#define CACHE_HEADER_SIZE 64
+
+// ==================== CABECERA ====================
+
+static void put_u16(unsigned char* p, uint32_t value) {
+    p[0] = (unsigned char)value;
+    p[1] = (unsigned char)(value >> 8);
+}
+
+static void put_u32(unsigned char* p, uint32_t value) {
+    for (int i = 0; i < 4; i++) p[i] = (unsigned char)(value >> (8 * i));
+}
+
+static void put_u64(unsigned char* p, uint64_t value) {
+    for (int i = 0; i < 8; i++) p[i] = (unsigned char)(value >> (8 * i));
+}
+
+static uint32_t get_u16(const unsigned char* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+static uint32_t get_u32(const unsigned char* p) {
+    uint32_t value = 0;
+    for (int i = 0; i < 4; i++) value |= (uint32_t)p[i] << (8 * i);
+    return value;
+}
+
+static uint64_t get_u64(const unsigned char* p) {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; i++) value |= (uint64_t)p[i] << (8 * i);
+    return value;
+}
+
+// ==================== API PUBLICA ====================
+
+uint64_t cache_hash(const char* data, size_t length) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+const char* cache_dir(void) {
+    const char* dir = getenv("MINI0_CACHE_DIR");
+    if (dir != NULL && dir[0] != '\0') return dir;
+    return CACHE_DEFAULT_DIR;
+}
+
+static void cache_path(char* path, size_t size, const char* dir, uint64_t hash) {
+    snprintf(path, size, "%s/%016llx.m0t", dir, (unsigned long long)hash);
+}
+
+static unsigned char* map_file(const char* path, size_t* size) {
+#ifdef _WIN32
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) return NULL;
+    
+    fseek(file, 0L, SEEK_END);
+    long length = ftell(file);
+    rewind(file);
+    
+    unsigned char* data = (unsigned char*)malloc(length > 0 ? length : 1);
+    if (data == NULL || fread(data, 1, length, file) != (size_t)length) {
+        free(data);
+        fclose(file);
+        return NULL;
+    }
+    
+    fclose(file);
+    *size = (size_t)length;
+    return data;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+    
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < CACHE_HEADER_SIZE) {
+        close(fd);
+        return NULL;
+    }
+    
+    void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return NULL;
+    
+    *size = (size_t)st.st_size;
+    return (unsigned char*)data;
+#endif
+}
+
+static void unmap_file(const unsigned char* data, size_t size) {
+#ifdef _WIN32
+    (void)size;
+    free((void*)data);
+#else
+    munmap((void*)data, size);
+#endif
+}
+
+// Mapear una entrada y validar solo la cabecera (magic, version del
+// formato y de los diagnosticos) y los limites de las secciones
+static int cache_load(CacheFile* file, const char* path) {
+    memset(file, 0, sizeof(*file));
+    
+    size_t size = 0;
+    const unsigned char* data = map_file(path, &size);
+    if (data == NULL) return 0;
+    
+    // Todo se direcciona por offsets relativos al inicio del archivo: basta
+    // validar la cabecera y los limites de cada seccion
+    const unsigned char* h = data;
+    int valid = size >= CACHE_HEADER_SIZE &&
+                memcmp(h, CACHE_MAGIC, 4) == 0 &&
+                get_u16(h + 4) == CACHE_FORMAT_VERSION &&
+                get_u16(h + 6) == CACHE_HEADER_SIZE &&
+                get_u32(h + 44) == PARSER_DIAGNOSTICS_VERSION;
+    
+    if (valid) {
+        uint32_t diag_offset = get_u32(h + 36);
+        uint32_t diag_length = get_u32(h + 40);
+        uint64_t source_offset = get_u64(h + 56);
+        uint64_t source_length = get_u64(h + 16);
+        
+        valid = (uint64_t)diag_offset + diag_length <= size &&
+                source_offset <= size && source_length <= size - source_offset;
+        
+        if (valid) {
+            file->diagnostics = (const char*)data + diag_offset;
+            file->diagnostics_length = diag_length;
+            file->source = (const char*)data + source_offset;
+        }
+    }
+    
+    if (!valid) {
+        unmap_file(data, size);
+        return 0;
+    }
+    
+    file->data = data;
+    file->size = size;
+    file->source_hash = get_u64(h + 8);
+    file->source_length = get_u64(h + 16);
+    file->max_depth = (int)get_u32(h + 24);
+    file->error_burst = (int)get_u32(h + 48);
+    file->error_density = (int)get_u32(h + 52);
+    file->success = (int)get_u32(h + 28);
+    file->error_count = (int)get_u32(h + 32);
+    return 1;
+}
+
+int cache_open(CacheFile* file, const char* dir, uint64_t hash,
+               const char* source, size_t source_length) {
+    char path[1024];
+    cache_path(path, sizeof(path), dir, hash);
+    
+    if (!cache_load(file, path)) return 0;
+    
+    // El hash solo elige la entrada: una colisión no debe devolver los
+    // diagnósticos de otro fuente, así que se compara el contenido
+    if (file->source_hash != hash ||
+        file->source_length != (uint64_t)source_length ||
+        file->max_depth != PARSER_MAX_DEPTH ||
+        file->error_burst != PARSER_ERROR_BURST ||
+        file->error_density != PARSER_ERROR_DENSITY ||
+        memcmp(file->source, source, source_length) != 0) {
+        cache_close(file);
+        return 0;
+    }
+    return 1;
+}
+
+void cache_close(CacheFile* file) {
+    if (file->data != NULL) {
+        unmap_file(file->data, file->size);
+    }
+    memset(file, 0, sizeof(*file));
+}
+
+static int make_dir(const char* dir) {
+#ifdef _WIN32
+    return _mkdir(dir) == 0 || errno == EEXIST;
+#else
+    struct stat st;
+    if (stat(dir, &st) == 0) return S_ISDIR(st.st_mode);
+    return mkdir(dir, 0755) == 0;
+#endif
+}
+
+// Escribir una entrada en 'path' (a traves de un temporal que se renombra)
+static int cache_write(const char* path, uint64_t hash, const char* source,
+                       size_t source_length, int success, int error_count,
+                       const char* diagnostics, size_t diagnostics_length) {
+    // Cabecera
+    unsigned char header[CACHE_HEADER_SIZE];
+    memset(header, 0, sizeof(header));
+    memcpy(header, CACHE_MAGIC, 4);
+    put_u16(header + 4, CACHE_FORMAT_VERSION);
+    put_u16(header + 6, CACHE_HEADER_SIZE);
+    put_u64(header + 8, hash);
+    put_u64(header + 16, (uint64_t)source_length);
+    put_u32(header + 24, PARSER_MAX_DEPTH);
+    put_u32(header + 28, (uint32_t)success);
+    put_u32(header + 32, (uint32_t)error_count);
+    put_u32(header + 36, CACHE_HEADER_SIZE);
+    put_u32(header + 40, (uint32_t)diagnostics_length);
+    put_u32(header + 44, PARSER_DIAGNOSTICS_VERSION);
+    put_u32(header + 48, PARSER_ERROR_BURST);
+    put_u32(header + 52, PARSER_ERROR_DENSITY);
+    put_u64(header + 56, (uint64_t)CACHE_HEADER_SIZE + diagnostics_length);
+    
+    // Escribir en un temporal y renombrar, para que un lector concurrente
+    // nunca vea una entrada a medio escribir
+    char temp[1100];
+    snprintf(temp, sizeof(temp), "%s.%d.tmp", path, (int)getpid());
+    
+    int ok = 0;
+    FILE* out = fopen(temp, "wb");
+    if (out != NULL) {
+        ok = fwrite(header, 1, sizeof(header), out) == sizeof(header) &&
+             fwrite(diagnostics, 1, diagnostics_length, out) == diagnostics_length &&
+             fwrite(source, 1, source_length, out) == source_length;
+        ok = (fclose(out) == 0) && ok;
+        
+        if (ok) {
+#ifdef _WIN32
+            remove(path);
+#endif
+            ok = rename(temp, path) == 0;
+        }
+        if (!ok) remove(temp);
+    }
+    
+    return ok;
+}
+
+int cache_store(const char* dir, uint64_t hash, const char* source,
+                size_t source_length, int success, int error_count,
+                const char* diagnostics, size_t diagnostics_length) {
+    if (!make_dir(dir)) return 0;
+    
+    char path[1024];
+    cache_path(path, sizeof(path), dir, hash);
+    return cache_write(path, hash, source, source_length, success,
+                       error_count, diagnostics, diagnostics_length);
+}
@@ -0,0 +1,62 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Cache en disco del resultado del analisis.
+//
+// Cada archivo se identifica por el hash del contenido fuente y guarda,
+// en formato binario versionado:
+//   - cabecera fija (magic, version, hash, longitud, resultado, y la
+//     configuracion del checker que lo produjo: PARSER_MAX_DEPTH,
+//     PARSER_ERROR_BURST, PARSER_ERROR_DENSITY y
+//     PARSER_DIAGNOSTICS_VERSION)
+//   - texto de diagnosticos tal como lo reporto el parser
+//   - copia del fuente, para que una colision del hash no sea un acierto
+// Al cargar se mapea el archivo (mmap) y los diagnosticos se usan en el
+// lugar, sin copiarlos.
+
+#define CACHE_FORMAT_VERSION 3
+#define CACHE_DEFAULT_DIR ".mini0cache"
+
+typedef struct {
+    const unsigned char* data;  // Contenido mapeado
+    size_t size;
+
+    uint64_t source_hash;
+    uint64_t source_length;
+    int max_depth;              // PARSER_MAX_DEPTH con que se analizo
+    int error_burst;            // PARSER_ERROR_BURST
+    int error_density;          // PARSER_ERROR_DENSITY
+    int success;                // Resultado de parser_parse
+    int error_count;
+
+    const char* diagnostics;    // Texto de diagnosticos (no terminado en '\0')
+    size_t diagnostics_length;
+
+    const char* source;         // Fuente analizado (source_length bytes)
+} CacheFile;
+
+// Hash del contenido fuente (FNV-1a de 64 bits)
+uint64_t cache_hash(const char* data, size_t length);
+
+// Directorio de cache: $MINI0_CACHE_DIR o CACHE_DEFAULT_DIR
+const char* cache_dir(void);
+
+// Abrir la entrada de cache para el fuente dado ('hash' es su
+// cache_hash). Retorna 1 si existe y es valida: versiones, configuracion
+// del checker y contenido del fuente coinciden; 0 si no.
+int cache_open(CacheFile* file, const char* dir, uint64_t hash,
+               const char* source, size_t source_length);
+
+// Liberar el mapeo de un CacheFile abierto
+void cache_close(CacheFile* file);
+
+// Guardar el resultado del analisis en el directorio de cache. Retorna 1
+// si se escribio la entrada.
+int cache_store(const char* dir, uint64_t hash, const char* source, size_t source_length,
+                int success, int error_count, const char* diagnostics,
+                size_t diagnostics_length);
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef HINTS_H
+#define HINTS_H
+
+// Anotaciones de frecuencia para el compilador. Marcan las ramas y
+// funciones de error como improbables para que queden fuera del camino
+// caliente. Una compilación con PGO (tools/pgo_build.sh) obtiene esta
+// información de ejecuciones reales; sin PGO, estas marcas dan al
+// compilador la parte más segura de ella. En compiladores sin soporte no
+// hacen nada.
+#if defined(__GNUC__) || defined(__clang__)
+#define LIKELY(x)   __builtin_expect(!!(x), 1)
+#define UNLIKELY(x) __builtin_expect(!!(x), 0)
+#define COLD        __attribute__((cold, noinline))
+#else
+#define LIKELY(x)   (x)
+#define UNLIKELY(x) (x)
+#define COLD
+#endif
+
+#endif
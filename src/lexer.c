@@ -1,37 +1,12 @@
 // lexer.c
 #include "lexer.h"
+#include "lexer_tables.h"
+#include "lexer_simd.h"
+#include "hints.h"
 #include <stdlib.h>
 #include <string.h>
-#include <ctype.h>
 #include <stdio.h>
 
-// Tabla de palabras reservadas
-typedef struct {
-    const char* keyword;
-    TokenType type;
-} Keyword;
-
-static Keyword keywords[] = {
-    {"if", TOKEN_IF},
-    {"else", TOKEN_ELSE},
-    {"end", TOKEN_END},
-    {"while", TOKEN_WHILE},
-    {"loop", TOKEN_LOOP},
-    {"fun", TOKEN_FUN},
-    {"return", TOKEN_RETURN},
-    {"new", TOKEN_NEW},
-    {"string", TOKEN_STRING},
-    {"int", TOKEN_INT},
-    {"char", TOKEN_CHAR},
-    {"bool", TOKEN_BOOL},
-    {"true", TOKEN_TRUE},
-    {"false", TOKEN_FALSE},
-    {"and", TOKEN_AND},
-    {"or", TOKEN_OR},
-    {"not", TOKEN_NOT},
-    {NULL, TOKEN_ERROR}
-};
-
 const char* token_type_name(TokenType type) {
     switch (type) {
         case TOKEN_EOF: return "EOF";
@@ -86,12 +61,25 @@ void lexer_init(Lexer* lexer, const char* source) {
     lexer->start_column = 1;
     lexer->had_error = 0;
     lexer->error_message[0] = '\0';
+    lexer->stats = NULL;
+    lexer->discard = 0;
+    lexer->arena = NULL;
+    lexer->padded = 0;
+    lexer->end = NULL;
+    lexer->refill = NULL;
+    lexer->refill_data = NULL;
 }
 
 static int is_at_end(Lexer* lexer) {
     return *lexer->current == '\0';
 }
 
+// Con el lexer en un '\0': ¿es un byte del propio fuente (antes de 'end')
+// y no su final?
+static int is_source_nul(Lexer* lexer) {
+    return lexer->end != NULL && lexer->current < lexer->end;
+}
+
 static char advance(Lexer* lexer) {
     lexer->column++;
     return *lexer->current++;
@@ -106,12 +94,10 @@ static char peek_next(Lexer* lexer) {
     return lexer->current[1];
 }
 
-static int match(Lexer* lexer, char expected) {
-    if (is_at_end(lexer)) return 0;
-    if (*lexer->current != expected) return 0;
-    lexer->current++;
-    lexer->column++;
-    return 1;
+// Memoria para lexemas y strings: de la arena si hay una, si no malloc
+static char* lexer_alloc(Lexer* lexer, size_t size) {
+    if (lexer->arena != NULL) return (char*)arena_alloc(lexer->arena, size);
+    return (char*)malloc(size);
 }
 
 static Token make_token(Lexer* lexer, TokenType type) {
@@ -121,25 +107,39 @@ static Token make_token(Lexer* lexer, TokenType type) {
     token.column = lexer->start_column;
     token.int_value = 0;
     token.string_value = NULL;
+    token.start = lexer->start;
+    token.length = (int)(lexer->current - lexer->start);
+    token.lexeme = NULL;
+    
+    STATS_TOKEN(lexer->stats, type);
+    if (lexer->discard) return token;
+    
+    token.lexeme = lexer_alloc(lexer, token.length + 1);
+    memcpy(token.lexeme, lexer->start, token.length);
+    token.lexeme[token.length] = '\0';
     
-    int length = (int)(lexer->current - lexer->start);
-    token.lexeme = (char*)malloc(length + 1);
-    memcpy(token.lexeme, lexer->start, length);
-    token.lexeme[length] = '\0';
+    STATS_BYTES(lexer->stats, token.length + 1);
     
     return token;
 }
 
-static Token error_token(Lexer* lexer, const char* message) {
+COLD static Token error_token(Lexer* lexer, const char* message) {
     Token token;
     token.type = TOKEN_ERROR;
     token.line = lexer->line;
     token.column = lexer->start_column;
     token.int_value = 0;
     token.string_value = NULL;
+    token.start = lexer->start;
+    token.length = (int)(lexer->current - lexer->start);
+    token.lexeme = NULL;
     
-    token.lexeme = (char*)malloc(strlen(message) + 1);
-    strcpy(token.lexeme, message);
+    STATS_TOKEN(lexer->stats, TOKEN_ERROR);
+    if (!lexer->discard) {
+        token.lexeme = lexer_alloc(lexer, strlen(message) + 1);
+        strcpy(token.lexeme, message);
+        STATS_BYTES(lexer->stats, strlen(message) + 1);
+    }
     
     lexer->had_error = 1;
     strncpy(lexer->error_message, message, 255);
@@ -148,26 +148,36 @@ static Token error_token(Lexer* lexer, const char* message) {
     return token;
 }
 
+// Avanzar hasta el primer 'a', 'b', 'c' o '\0' (sin saltos de línea en
+// medio, salvo que alguno de ellos sea '\n')
+static void skip_until(Lexer* lexer, char a, char b, char c) {
+    const char* p = scan_until(lexer->current, lexer->padded, a, b, c);
+    lexer->column += (int)(p - lexer->current);
+    lexer->current = p;
+}
+
 static void skip_whitespace(Lexer* lexer) {
     for (;;) {
-        char c = peek(lexer);
-        switch (c) {
-            case ' ':
-            case '\r':
-            case '\t':
+        switch (char_class[(unsigned char)peek(lexer)]) {
+            case C_WS:
                 advance(lexer);
                 break;
-            case '/':
+            case C_SLASH:
                 if (peek_next(lexer) == '/') {
-                    // Comentario de línea //
-                    while (peek(lexer) != '\n' && !is_at_end(lexer)) {
+                    // Comentario de línea //; un '\0' dentro del
+                    // comentario es un byte más
+                    skip_until(lexer, '\n', '\n', '\n');
+                    while (is_at_end(lexer) && is_source_nul(lexer)) {
                         advance(lexer);
+                        skip_until(lexer, '\n', '\n', '\n');
                     }
                 } else if (peek_next(lexer) == '*') {
                     // Comentario de bloque /* */
                     advance(lexer); // /
                     advance(lexer); // *
-                    while (!is_at_end(lexer)) {
+                    for (;;) {
+                        skip_until(lexer, '*', '\n', '\n');
+                        if (is_at_end(lexer) && !is_source_nul(lexer)) break;
                         if (peek(lexer) == '*' && peek_next(lexer) == '/') {
                             advance(lexer); // *
                             advance(lexer); // /
@@ -189,30 +199,40 @@ static void skip_whitespace(Lexer* lexer) {
     }
 }
 
+// Valor de una secuencia de escape (el caracter despues de '\\'), o '\0'
+// si no es válida
+static char escape_value(char c) {
+    switch (c) {
+        case '\\': return '\\';
+        case 'n':  return '\n';
+        case 't':  return '\t';
+        case '"':  return '"';
+        default:   return '\0';
+    }
+}
+
 static Token scan_string(Lexer* lexer) {
-    // Buffer para el string procesado (sin escapes)
-    char buffer[4096];
-    int buf_pos = 0;
+    int has_nul = 0;
     
-    while (peek(lexer) != '"' && !is_at_end(lexer)) {
+    // Primera pasada: validar y encontrar la comilla de cierre
+    for (;;) {
+        skip_until(lexer, '"', '\\', '\n');
         if (peek(lexer) == '\n') {
             return error_token(lexer, "String sin terminar");
         }
-        
-        if (peek(lexer) == '\\') {
-            advance(lexer); // consumir '\'
-            switch (peek(lexer)) {
-                case '\\': buffer[buf_pos++] = '\\'; break;
-                case 'n':  buffer[buf_pos++] = '\n'; break;
-                case 't':  buffer[buf_pos++] = '\t'; break;
-                case '"':  buffer[buf_pos++] = '"';  break;
-                default:
-                    return error_token(lexer, "Secuencia de escape invalida");
-            }
+        if (is_at_end(lexer) && is_source_nul(lexer)) {
+            // El string sigue hasta su comilla, pero no es válido
+            has_nul = 1;
             advance(lexer);
-        } else {
-            buffer[buf_pos++] = advance(lexer);
+            continue;
+        }
+        if (peek(lexer) != '\\') break;
+        
+        advance(lexer);
+        if (escape_value(peek(lexer)) == '\0') {
+            return error_token(lexer, "Secuencia de escape invalida");
         }
+        advance(lexer);
     }
     
     if (is_at_end(lexer)) {
@@ -220,126 +240,275 @@ static Token scan_string(Lexer* lexer) {
     }
     
     advance(lexer); // Cerrar comilla "
-    buffer[buf_pos] = '\0';
+    
+    if (has_nul) {
+        return error_token(lexer, "Caracter nulo en el fuente");
+    }
     
     Token token = make_token(lexer, TOKEN_LITSTRING);
-    token.string_value = (char*)malloc(buf_pos + 1);
-    strcpy(token.string_value, buffer);
+    if (lexer->discard) return token;
     
-    return token;
-}
-
-static Token scan_number(Lexer* lexer) {
-    // Verificar si es hexadecimal
-    if (lexer->start[0] == '0' && (peek(lexer) == 'x' || peek(lexer) == 'X')) {
-        advance(lexer); // consumir 'x'
-        
-        if (!isxdigit(peek(lexer))) {
-            return error_token(lexer, "Numero hexadecimal invalido");
-        }
-        
-        while (isxdigit(peek(lexer))) {
-            advance(lexer);
-        }
-        
-        Token token = make_token(lexer, TOKEN_LITNUMERAL);
-        token.int_value = (int)strtol(lexer->start, NULL, 16);
-        return token;
-    }
+    // Segunda pasada: copiar el contenido resolviendo escapes. El texto sin
+    // escapes nunca es más largo que el original, así que basta una reserva.
+    const char* p = lexer->start + 1;
+    const char* end = lexer->current - 1;
+    char* value = lexer_alloc(lexer, (size_t)(end - p) + 1);
+    int length = 0;
     
-    // Número decimal
-    while (isdigit(peek(lexer))) {
-        advance(lexer);
+    while (p < end) {
+        char c = *p++;
+        if (c == '\\') c = escape_value(*p++);
+        value[length++] = c;
     }
+    value[length] = '\0';
+    
+    token.string_value = value;
+    STATS_BYTES(lexer->stats, (size_t)(end - lexer->start));
     
-    Token token = make_token(lexer, TOKEN_LITNUMERAL);
-    token.int_value = (int)strtol(lexer->start, NULL, 10);
     return token;
 }
 
-static TokenType check_keyword(Lexer* lexer) {
-    int length = (int)(lexer->current - lexer->start);
-    
-    for (int i = 0; keywords[i].keyword != NULL; i++) {
-        if ((int)strlen(keywords[i].keyword) == length &&
-            memcmp(lexer->start, keywords[i].keyword, length) == 0) {
-            return keywords[i].type;
-        }
+// Verificar el resto de una palabra reservada
+static TokenType check_rest(const char* text, int length, int start,
+                            const char* rest, TokenType type) {
+    int rest_length = (int)strlen(rest);
+    if (length == start + rest_length &&
+        memcmp(text + start, rest, rest_length) == 0) {
+        return type;
+    }
+    return TOKEN_ID;
+}
+
+// Clasificar un identificador como palabra reservada (o TOKEN_ID)
+static TokenType keyword_type(const char* text, int length) {
+    switch (text[0]) {
+        case 'a': return check_rest(text, length, 1, "nd", TOKEN_AND);
+        case 'b': return check_rest(text, length, 1, "ool", TOKEN_BOOL);
+        case 'c': return check_rest(text, length, 1, "har", TOKEN_CHAR);
+        case 'e':
+            if (length == 3) return check_rest(text, length, 1, "nd", TOKEN_END);
+            return check_rest(text, length, 1, "lse", TOKEN_ELSE);
+        case 'f':
+            if (length == 3) return check_rest(text, length, 1, "un", TOKEN_FUN);
+            return check_rest(text, length, 1, "alse", TOKEN_FALSE);
+        case 'i':
+            if (length == 2) return check_rest(text, length, 1, "f", TOKEN_IF);
+            return check_rest(text, length, 1, "nt", TOKEN_INT);
+        case 'l': return check_rest(text, length, 1, "oop", TOKEN_LOOP);
+        case 'n':
+            if (length > 1 && text[1] == 'e') return check_rest(text, length, 2, "w", TOKEN_NEW);
+            return check_rest(text, length, 1, "ot", TOKEN_NOT);
+        case 'o': return check_rest(text, length, 1, "r", TOKEN_OR);
+        case 'r': return check_rest(text, length, 1, "eturn", TOKEN_RETURN);
+        case 's': return check_rest(text, length, 1, "tring", TOKEN_STRING);
+        case 't': return check_rest(text, length, 1, "rue", TOKEN_TRUE);
+        case 'w': return check_rest(text, length, 1, "hile", TOKEN_WHILE);
     }
     
     return TOKEN_ID;
 }
 
-static Token scan_identifier(Lexer* lexer) {
-    while (isalnum(peek(lexer)) || peek(lexer) == '_') {
+// DFA de tokens (tablas en lexer_tables.h): reconoce identificadores,
+// números decimales y hexadecimales, operadores de uno y dos caracteres
+// y puntuación en un solo ciclo, acumulando el valor numérico al avanzar
+static Token scan_dfa(Lexer* lexer) {
+    const char* p = lexer->current;
+    int state = S_START;
+    unsigned int value = 0;
+    
+    for (;;) {
+        unsigned char c = (unsigned char)*p;
+        int next = dfa_next[state][char_class[c]];
+        if (next == S_STOP) break;
+        
+        // Solo tiene sentido en estados numéricos; en el resto se ignora
+        value = value * dfa_radix[next] + digit_value[c];
+        state = next;
+        p++;
+    }
+    
+    if (UNLIKELY(state == S_START)) {
         advance(lexer);
+        return error_token(lexer, "Caracter inesperado");
     }
     
-    return make_token(lexer, check_keyword(lexer));
+    lexer->column += (int)(p - lexer->current);
+    lexer->current = p;
+    
+    TokenType type = (TokenType)dfa_accept[state];
+    if (UNLIKELY(type == TOKEN_ERROR)) {
+        // Único estado no aceptador alcanzable: '0x' sin dígitos
+        return error_token(lexer, "Numero hexadecimal invalido");
+    }
+    
+    if (type == TOKEN_ID) {
+        type = keyword_type(lexer->start, (int)(p - lexer->start));
+    }
+    
+    Token token = make_token(lexer, type);
+    if (type == TOKEN_LITNUMERAL) {
+        token.int_value = (int)value;
+    }
+    return token;
 }
 
-Token lexer_next_token(Lexer* lexer) {
+static Token scan_token(Lexer* lexer) {
     skip_whitespace(lexer);
     
     lexer->start = lexer->current;
     lexer->start_column = lexer->column;
     
-    if (is_at_end(lexer)) {
-        return make_token(lexer, TOKEN_EOF);
-    }
-    
-    char c = advance(lexer);
-    
-    // Salto de línea
-    if (c == '\n') {
-        // Consumir múltiples saltos de línea consecutivos
-        while (peek(lexer) == '\n' || peek(lexer) == '\r' || 
-               peek(lexer) == ' ' || peek(lexer) == '\t') {
-            if (peek(lexer) == '\n') {
-                lexer->line++;
-                lexer->column = 0;
+    switch (char_class[(unsigned char)peek(lexer)]) {
+        case C_NUL:
+            if (is_source_nul(lexer)) {
+                advance(lexer);
+                return error_token(lexer, "Caracter nulo en el fuente");
             }
+            return make_token(lexer, TOKEN_EOF);
+        
+        case C_NL:
+            // Salto de línea
             advance(lexer);
-        }
-        lexer->line++;
-        lexer->column = 1;
-        return make_token(lexer, TOKEN_NL);
+            
+            // Consumir múltiples saltos de línea consecutivos
+            while (peek(lexer) == '\n' || peek(lexer) == '\r' || 
+                   peek(lexer) == ' ' || peek(lexer) == '\t') {
+                if (peek(lexer) == '\n') {
+                    lexer->line++;
+                    lexer->column = 0;
+                }
+                advance(lexer);
+            }
+            lexer->line++;
+            lexer->column = 1;
+            return make_token(lexer, TOKEN_NL);
+        
+        case C_QUOTE:
+            advance(lexer);
+            return scan_string(lexer);
     }
     
-    // Identificadores
-    if (isalpha(c) || c == '_') {
-        return scan_identifier(lexer);
+    return scan_dfa(lexer);
+}
+
+// Entrada por partes: un token que llega al final de los datos cargados
+// puede seguir en la parte siguiente (un identificador, un comentario, el
+// '=' de '>='), así que se descarta, se piden más datos y se escanea de
+// nuevo desde el mismo punto. Se piden al menos tantos bytes como los
+// escaneados, para que un token muy largo no se reescanee en cada parte.
+static Token scan_token_chunked(Lexer* lexer) {
+    for (;;) {
+        const char* resume = lexer->current;
+        int line = lexer->line;
+        int column = lexer->column;
+        int had_error = lexer->had_error;
+        
+        Token token = scan_token(lexer);
+        if (lexer->end - lexer->current >= 2) return token;
+        
+        lexer_free_token(lexer, &token);
+        size_t scanned = (size_t)(lexer->end - resume);
+        lexer->current = resume;
+        lexer->start = resume;
+        lexer->line = line;
+        lexer->column = column;
+        lexer->had_error = had_error;
+        
+        if (!lexer->refill(lexer, scanned + 1)) {
+            // Lo cargado llega hasta el final del fuente
+            lexer->refill = NULL;
+            return scan_token(lexer);
+        }
     }
+}
+
+Token lexer_next_token(Lexer* lexer) {
+    if (UNLIKELY(lexer->refill != NULL)) return scan_token_chunked(lexer);
+    return scan_token(lexer);
+}
+
+Token lexer_skip_token(Lexer* lexer) {
+    lexer->discard = 1;
+    Token token = lexer_next_token(lexer);
+    lexer->discard = 0;
+    return token;
+}
+
+static int starts_with_word(const char* text, const char* word, size_t length) {
+    if (strncmp(text, word, length) != 0) return 0;
+    int cls = char_class[(unsigned char)text[length]];
+    return cls != C_ALPHA && cls != C_HEXALPHA && cls != C_X &&
+           cls != C_ZERO && cls != C_DIGIT;
+}
+
+// Entrada por partes: 'p' llegó al final de los datos cargados; cargar
+// más desde ahí. Retorna 0 si el fuente terminó (o si 'p' es un '\0' del
+// propio fuente).
+static int load_more(Lexer* lexer, const char* p) {
+    if (lexer->refill == NULL || p != lexer->end) return 0;
+    
+    lexer->current = p;
+    lexer->start = p;
+    if (lexer->refill(lexer, 1)) return 1;
     
-    // Números
-    if (isdigit(c)) {
-        return scan_number(lexer);
+    lexer->refill = NULL;
+    return 0;
+}
+
+void lexer_skip_to_line_with(Lexer* lexer, const char* word) {
+    size_t length = strlen(word);
+    const char* p = lexer->current;
+    
+    // La posición actual puede ser ya un inicio de línea (tras un NL)
+    const char* back = p;
+    while (back > lexer->source && (back[-1] == ' ' || back[-1] == '\t' ||
+                                    back[-1] == '\r')) {
+        back--;
+    }
+    if (back == lexer->source || back[-1] == '\n') {
+        while (*p == ' ' || *p == '\t' || *p == '\r') p++;
+        if (starts_with_word(p, word, length)) {
+            lexer->column += (int)(p - lexer->current);
+            lexer->current = p;
+            return;
+        }
     }
     
-    // Operadores y puntuación
-    switch (c) {
-        case '(': return make_token(lexer, TOKEN_LPAREN);
-        case ')': return make_token(lexer, TOKEN_RPAREN);
-        case '[': return make_token(lexer, TOKEN_LBRACKET);
-        case ']': return make_token(lexer, TOKEN_RBRACKET);
-        case ',': return make_token(lexer, TOKEN_COMMA);
-        case ':': return make_token(lexer, TOKEN_COLON);
-        case '+': return make_token(lexer, TOKEN_PLUS);
-        case '-': return make_token(lexer, TOKEN_MINUS);
-        case '*': return make_token(lexer, TOKEN_STAR);
-        case '/': return make_token(lexer, TOKEN_SLASH);
-        case '=': return make_token(lexer, TOKEN_EQ);
-        case '>':
-            return make_token(lexer, match(lexer, '=') ? TOKEN_GE : TOKEN_GT);
-        case '<':
-            if (match(lexer, '=')) return make_token(lexer, TOKEN_LE);
-            if (match(lexer, '>')) return make_token(lexer, TOKEN_NE);
-            return make_token(lexer, TOKEN_LT);
-        case '"':
-            return scan_string(lexer);
+    // Recorrer línea por línea con strchr (sin tokenizar)
+    for (;;) {
+        const char* newline = strchr(p, '\n');
+        const char* line_start;
+        
+        if (newline != NULL) {
+            lexer->line++;
+            line_start = newline + 1;
+        } else {
+            p += strlen(p);
+            if (lexer->end != NULL && p < lexer->end) {
+                // Un '\0' del propio fuente: se salta como cualquier byte
+                p++;
+                continue;
+            }
+            if (!load_more(lexer, p)) {
+                lexer->column = 1;
+                break;
+            }
+            
+            // Las partes se cargan por líneas completas: el final de lo
+            // cargado era un inicio de línea
+            line_start = lexer->current;
+        }
+        
+        p = line_start;
+        while (*p == ' ' || *p == '\t' || *p == '\r') p++;
+        
+        if (starts_with_word(p, word, length)) {
+            lexer->column = 1 + (int)(p - line_start);
+            break;
+        }
     }
     
-    return error_token(lexer, "Caracter inesperado");
+    lexer->current = p;
 }
 
 void token_free(Token* token) {
@@ -353,6 +522,15 @@ void token_free(Token* token) {
     }
 }
 
+void lexer_free_token(Lexer* lexer, Token* token) {
+    if (lexer->arena == NULL) {
+        token_free(token);
+        return;
+    }
+    token->lexeme = NULL;
+    token->string_value = NULL;
+}
+
 int lexer_had_error(Lexer* lexer) {
     return lexer->had_error;
 }
\ No newline at end of file
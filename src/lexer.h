@@ -2,10 +2,27 @@
 #define LEXER_H
 
 #include "tokens.h"
+#include "stats.h"
+#include "arena.h"
 #include <stdio.h>
 
-typedef struct {
-    const char* source;     // Código fuente completo
+// Bytes que se reservan después del '\0' final de un fuente para que la
+// búsqueda vectorial de lexer_simd.h no lea fuera del buffer: la carga
+// más grande es de 32 bytes y nunca empieza después del '\0'.
+#define SIMD_PAD 32
+
+typedef struct Lexer Lexer;
+
+// Pedir más datos (entrada por partes, ver push_parser.h). Conserva los
+// bytes desde lexer->current - 1 (un byte de historia), agrega al menos
+// 'want' bytes nuevos en líneas completas (salvo la última línea del
+// fuente) y actualiza source, start, current y end. Los tokens retornados
+// antes dejan de ser válidos. Retorna 0, sin cambiar nada, si ya no hay
+// más datos.
+typedef int (*LexerRefill)(Lexer* lexer, size_t want);
+
+struct Lexer {
+    const char* source;     // Código fuente completo (o datos cargados)
     const char* start;      // Inicio del token actual
     const char* current;    // Posición actual
     int line;               // Línea actual
@@ -15,7 +32,30 @@ typedef struct {
     // Para manejo de errores
     int had_error;
     char error_message[256];
-} Lexer;
+    
+    // Contadores de --stats (NULL si no se recolectan)
+    Stats* stats;
+    
+    // Modo descarte (lexer_skip_token): los tokens no reservan memoria
+    int discard;
+    
+    // Si no es NULL, lexemas y strings se reservan en esta arena y se
+    // liberan con arena_reset, no token por token
+    Arena* arena;
+    
+    // El fuente tiene SIMD_PAD bytes reservados después del '\0' final:
+    // permite buscar en comentarios y strings con cargas vectoriales
+    // (lexer_simd.h). Con 0 la búsqueda es byte a byte.
+    int padded;
+    
+    // Fin de los datos cargados: un '\0' antes de 'end' es un byte del
+    // fuente y se reporta como error ("Caracter nulo en el fuente"). Con
+    // NULL el fuente termina en el primer '\0'. Para la entrada por
+    // partes, 'refill' pide más datos (NULL si el fuente está completo).
+    const char* end;
+    LexerRefill refill;
+    void* refill_data;
+};
 
 // Inicializar el lexer con el código fuente
 void lexer_init(Lexer* lexer, const char* source);
@@ -23,9 +63,24 @@ void lexer_init(Lexer* lexer, const char* source);
 // Obtener el siguiente token
 Token lexer_next_token(Lexer* lexer);
 
+// Escanear el siguiente token sin reservar memoria: el token retornado
+// tiene tipo, posición y texto en el fuente (start/length), pero lexeme y
+// string_value son NULL
+Token lexer_skip_token(Lexer* lexer);
+
+// Saltar bytes sin tokenizar hasta la siguiente línea cuyo primer texto es
+// 'word' (seguido de un caracter que no sea de identificador), dejando el
+// lexer al inicio de esa palabra; si no hay ninguna, llega al final.
+// Ignora strings y comentarios: es solo para recuperación de errores.
+void lexer_skip_to_line_with(Lexer* lexer, const char* word);
+
 // Liberar memoria de un token
 void token_free(Token* token);
 
+// Liberar un token producido por 'lexer' (no libera nada si el lexer usa
+// una arena; solo limpia los punteros)
+void lexer_free_token(Lexer* lexer, Token* token);
+
 // Verificar si hubo error léxico
 int lexer_had_error(Lexer* lexer);
 
@@ -0,0 +1,99 @@
+// lexer_simd.h
+// Búsqueda de bytes con SIMD para los ciclos largos del lexer: cuerpo de
+// comentarios y de strings. Solo lo incluye lexer.c.
+#ifndef LEXER_SIMD_H
+#define LEXER_SIMD_H
+
+#include <stdint.h>
+
+// Retorna el primer byte desde 'p' igual a 'a', 'b', 'c' o '\0'. El fuente
+// siempre termina en '\0', así que la búsqueda no necesita longitud.
+//
+// Con 'padded' (lexer->padded), scan_until usa en x86 cargas alineadas de
+// 16 bytes (SSE2) o 32 bytes (AVX2, si la CPU lo soporta), que pueden leer
+// hasta 31 bytes después del '\0': el fuente reserva SIMD_PAD bytes tras
+// el '\0', así que esas lecturas quedan dentro del buffer. Los bytes hasta
+// la primera dirección alineada se revisan uno por uno. Sin 'padded', y
+// fuera de x86, la búsqueda es byte a byte y no pasa del '\0'.
+
+static inline const char* scan_until_scalar(const char* p, char a, char b, char c) {
+    for (;;) {
+        char ch = *p;
+        if (ch == a || ch == b || ch == c || ch == '\0') return p;
+        p++;
+    }
+}
+
+#if defined(__GNUC__) && defined(__SSE2__) && (defined(__x86_64__) || defined(__i386__))
+
+#include <immintrin.h>
+
+static inline const char* scan_until_sse2(const char* p, char a, char b, char c) {
+    while (((uintptr_t)p & 15) != 0) {
+        char ch = *p;
+        if (ch == a || ch == b || ch == c || ch == '\0') return p;
+        p++;
+    }
+    
+    const __m128i va = _mm_set1_epi8(a);
+    const __m128i vb = _mm_set1_epi8(b);
+    const __m128i vc = _mm_set1_epi8(c);
+    const __m128i zero = _mm_setzero_si128();
+    
+    for (;;) {
+        __m128i v = _mm_load_si128((const __m128i*)p);
+        __m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, va), _mm_cmpeq_epi8(v, vb)),
+                                   _mm_or_si128(_mm_cmpeq_epi8(v, vc), _mm_cmpeq_epi8(v, zero)));
+        int mask = _mm_movemask_epi8(hit);
+        if (mask != 0) return p + __builtin_ctz((unsigned int)mask);
+        p += 16;
+    }
+}
+
+__attribute__((target("avx2")))
+static const char* scan_until_avx2(const char* p, char a, char b, char c) {
+    while (((uintptr_t)p & 31) != 0) {
+        char ch = *p;
+        if (ch == a || ch == b || ch == c || ch == '\0') return p;
+        p++;
+    }
+    
+    const __m256i va = _mm256_set1_epi8(a);
+    const __m256i vb = _mm256_set1_epi8(b);
+    const __m256i vc = _mm256_set1_epi8(c);
+    const __m256i zero = _mm256_setzero_si256();
+    
+    for (;;) {
+        __m256i v = _mm256_load_si256((const __m256i*)p);
+        __m256i hit = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, va), _mm256_cmpeq_epi8(v, vb)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, vc), _mm256_cmpeq_epi8(v, zero)));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(hit);
+        if (mask != 0) return p + __builtin_ctz(mask);
+        p += 32;
+    }
+}
+
+static inline const char* scan_until(const char* p, int padded, char a, char b, char c) {
+    // La mayoría de las búsquedas terminan en pocos bytes (comentarios
+    // cortos, fin de línea): se revisan antes de entrar al ciclo vectorial
+    for (int i = 0; i < 8; i++, p++) {
+        char ch = *p;
+        if (ch == a || ch == b || ch == c || ch == '\0') return p;
+    }
+    
+    if (!padded) return scan_until_scalar(p, a, b, c);
+    if (__builtin_cpu_supports("avx2")) return scan_until_avx2(p, a, b, c);
+    return scan_until_sse2(p, a, b, c);
+}
+
+#else
+
+static inline const char* scan_until(const char* p, int padded, char a, char b, char c) {
+    (void)padded;
+    return scan_until_scalar(p, a, b, c);
+}
+
+#endif
+
+#endif
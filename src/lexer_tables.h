@@ -0,0 +1,164 @@
+// lexer_tables.h
+// Generado por tools/gen_lexer_tables.py. No editar a mano.
+#ifndef LEXER_TABLES_H
+#define LEXER_TABLES_H
+
+#include "tokens.h"
+
+// Clases de caracteres
+enum {
+    C_OTHER = 0,
+    C_NUL = 1,
+    C_WS = 2,
+    C_NL = 3,
+    C_QUOTE = 4,
+    C_ALPHA = 5,
+    C_HEXALPHA = 6,
+    C_X = 7,
+    C_ZERO = 8,
+    C_DIGIT = 9,
+    C_LT = 10,
+    C_GT = 11,
+    C_EQ = 12,
+    C_LPAREN = 13,
+    C_RPAREN = 14,
+    C_LBRACKET = 15,
+    C_RBRACKET = 16,
+    C_COMMA = 17,
+    C_COLON = 18,
+    C_PLUS = 19,
+    C_MINUS = 20,
+    C_STAR = 21,
+    C_SLASH = 22,
+    CHAR_CLASS_COUNT = 23
+};
+
+// Estados del DFA (S_STOP = sin transicion)
+enum {
+    S_STOP = 0,
+    S_START = 1,
+    S_ID = 2,
+    S_ZERO = 3,
+    S_DEC = 4,
+    S_HEX_PREFIX = 5,
+    S_HEX = 6,
+    S_LT = 7,
+    S_GT = 8,
+    S_LE = 9,
+    S_GE = 10,
+    S_NE = 11,
+    S_EQ = 12,
+    S_LPAREN = 13,
+    S_RPAREN = 14,
+    S_LBRACKET = 15,
+    S_RBRACKET = 16,
+    S_COMMA = 17,
+    S_COLON = 18,
+    S_PLUS = 19,
+    S_MINUS = 20,
+    S_STAR = 21,
+    S_SLASH = 22,
+    DFA_STATE_COUNT = 23
+};
+
+// Clase de cada byte (ASCII; bytes >= 0x80 son C_OTHER)
+static const unsigned char char_class[256] = {
+     1,  0,  0,  0,  0,  0,  0,  0,  0,  2,  3,  0,  0,  2,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     2,  0,  4,  0,  0,  0,  0,  0, 13, 14, 21, 19, 17, 20,  0, 22,
+     8,  9,  9,  9,  9,  9,  9,  9,  9,  9, 18,  0, 10, 12, 11,  0,
+     0,  6,  6,  6,  6,  6,  6,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  7,  5,  5, 15,  0, 16,  0,  5,
+     0,  6,  6,  6,  6,  6,  6,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  7,  5,  5,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+// Valor de digito de cada byte (0-9, a-f, A-F; 0 para el resto)
+static const unsigned char digit_value[256] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  0,  0,  0,  0,  0,  0,
+     0, 10, 11, 12, 13, 14, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0, 10, 11, 12, 13, 14, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+// Transiciones: dfa_next[estado][clase]
+static const unsigned char dfa_next[DFA_STATE_COUNT][CHAR_CLASS_COUNT] = {
+    /* S_STOP        */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_START       */ { 0,  0,  0,  0,  0,  2,  2,  2,  3,  4,  7,  8, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22},
+    /* S_ID          */ { 0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_ZERO        */ { 0,  0,  0,  0,  0,  0,  0,  5,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_DEC         */ { 0,  0,  0,  0,  0,  0,  0,  0,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_HEX_PREFIX  */ { 0,  0,  0,  0,  0,  0,  6,  0,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_HEX         */ { 0,  0,  0,  0,  0,  0,  6,  0,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_LT          */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 11,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_GT          */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_LE          */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_GE          */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_NE          */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_EQ          */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_LPAREN      */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_RPAREN      */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_LBRACKET    */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_RBRACKET    */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_COMMA       */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_COLON       */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_PLUS        */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_MINUS       */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_STAR        */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* S_SLASH       */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+};
+
+// Token aceptado en cada estado (TOKEN_ERROR = no aceptador)
+static const unsigned char dfa_accept[DFA_STATE_COUNT] = {
+    TOKEN_ERROR,       // S_STOP
+    TOKEN_ERROR,       // S_START
+    TOKEN_ID,          // S_ID
+    TOKEN_LITNUMERAL,  // S_ZERO
+    TOKEN_LITNUMERAL,  // S_DEC
+    TOKEN_ERROR,       // S_HEX_PREFIX
+    TOKEN_LITNUMERAL,  // S_HEX
+    TOKEN_LT,          // S_LT
+    TOKEN_GT,          // S_GT
+    TOKEN_LE,          // S_LE
+    TOKEN_GE,          // S_GE
+    TOKEN_NE,          // S_NE
+    TOKEN_EQ,          // S_EQ
+    TOKEN_LPAREN,      // S_LPAREN
+    TOKEN_RPAREN,      // S_RPAREN
+    TOKEN_LBRACKET,    // S_LBRACKET
+    TOKEN_RBRACKET,    // S_RBRACKET
+    TOKEN_COMMA,       // S_COMMA
+    TOKEN_COLON,       // S_COLON
+    TOKEN_PLUS,        // S_PLUS
+    TOKEN_MINUS,       // S_MINUS
+    TOKEN_STAR,        // S_STAR
+    TOKEN_SLASH,       // S_SLASH
+};
+
+// Base con la que cada estado acumula el valor numerico
+static const unsigned char dfa_radix[DFA_STATE_COUNT] = {
+     0,  0,  0,  0, 10,  0, 16,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+#endif
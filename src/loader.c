@@ -0,0 +1,534 @@
+// loader.c
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+
+#include "loader.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <stdio.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define LOADER_HAVE_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
+const char* loader_name(LoaderKind kind) {
+    switch (kind) {
+        case LOADER_URING: return "io_uring";
+        case LOADER_THREADS: return "hilos";
+        case LOADER_SYNC: return "secuencial";
+        default: return "auto";
+    }
+}
+
+// ==================== CARGA BLOQUEANTE ====================
+
+#ifdef _WIN32
+
+static void load_one(const char* path, LoadedFile* file) {
+    file->data = NULL;
+    file->length = 0;
+    
+    FILE* handle = fopen(path, "rb");
+    if (handle == NULL) {
+        file->status = LOAD_OPEN_FAILED;
+        return;
+    }
+    
+    fseek(handle, 0L, SEEK_END);
+    size_t size = (size_t)ftell(handle);
+    rewind(handle);
+    
+    file->data = (char*)malloc(size + 1);
+    if (file->data == NULL) {
+        file->status = LOAD_NO_MEMORY;
+        fclose(handle);
+        return;
+    }
+    
+    size_t got = fread(file->data, 1, size, handle);
+    fclose(handle);
+    if (got < size) {
+        free(file->data);
+        file->data = NULL;
+        file->status = LOAD_READ_FAILED;
+        return;
+    }
+    
+    file->data[got] = '\0';
+    file->length = got;
+    file->status = LOAD_OK;
+}
+
+#else
+
+static void load_one(const char* path, LoadedFile* file) {
+    file->data = NULL;
+    file->length = 0;
+    
+    int fd = open(path, O_RDONLY);
+    struct stat info;
+    if (fd < 0 || fstat(fd, &info) != 0) {
+        if (fd >= 0) close(fd);
+        file->status = LOAD_OPEN_FAILED;
+        return;
+    }
+    
+    size_t size = (size_t)info.st_size;
+    file->data = (char*)malloc(size + 1);
+    if (file->data == NULL) {
+        close(fd);
+        file->status = LOAD_NO_MEMORY;
+        return;
+    }
+    
+    size_t got = 0;
+    while (got < size) {
+        ssize_t count = read(fd, file->data + got, size - got);
+        if (count < 0 && errno == EINTR) continue;
+        if (count <= 0) break;
+        got += (size_t)count;
+    }
+    close(fd);
+    
+    if (got < size) {
+        free(file->data);
+        file->data = NULL;
+        file->status = LOAD_READ_FAILED;
+        return;
+    }
+    
+    file->data[got] = '\0';
+    file->length = got;
+    file->status = LOAD_OK;
+}
+
+#endif
+
+// Cargar paths[first..count) en orden
+static void load_sync(char** paths, int first, int count, LoaderDeliver deliver, void* context) {
+    for (int i = first; i < count; i++) {
+        LoadedFile file;
+        file.index = i;
+        load_one(paths[i], &file);
+        deliver(context, &file);
+    }
+}
+
+// ==================== HILOS ====================
+
+#ifndef _WIN32
+
+typedef struct {
+    char** paths;
+    int count;
+    int next;
+    pthread_mutex_t mutex;
+    LoaderDeliver deliver;
+    void* context;
+} ThreadShared;
+
+static void* reader_thread(void* argument) {
+    ThreadShared* shared = (ThreadShared*)argument;
+    
+    for (;;) {
+        pthread_mutex_lock(&shared->mutex);
+        int index = shared->next < shared->count ? shared->next++ : -1;
+        pthread_mutex_unlock(&shared->mutex);
+        if (index < 0) break;
+        
+        LoadedFile file;
+        file.index = index;
+        load_one(shared->paths[index], &file);
+        shared->deliver(shared->context, &file);
+    }
+    
+    return NULL;
+}
+
+static int load_threads(char** paths, int count, LoaderDeliver deliver, void* context) {
+    ThreadShared shared;
+    shared.paths = paths;
+    shared.count = count;
+    shared.next = 0;
+    shared.deliver = deliver;
+    shared.context = context;
+    pthread_mutex_init(&shared.mutex, NULL);
+    
+    pthread_t threads[LOADER_THREAD_COUNT];
+    int started = 0;
+    while (started < LOADER_THREAD_COUNT && started < count) {
+        if (pthread_create(&threads[started], NULL, reader_thread, &shared) != 0) break;
+        started++;
+    }
+    
+    // Sin hilos el hilo actual carga todo
+    if (started == 0) reader_thread(&shared);
+    
+    for (int i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    pthread_mutex_destroy(&shared.mutex);
+    return 1;
+}
+
+#endif
+
+// ==================== IO_URING ====================
+
+#ifdef LOADER_HAVE_URING
+
+// Anillos compartidos con el kernel (sin liburing: llamadas al sistema y
+// mmap directos)
+typedef struct {
+    int fd;
+    unsigned entries;
+    unsigned* sq_head;
+    unsigned* sq_tail;
+    unsigned* sq_mask;
+    unsigned* sq_array;
+    struct io_uring_sqe* sqes;
+    unsigned* cq_head;
+    unsigned* cq_tail;
+    unsigned* cq_mask;
+    struct io_uring_cqe* cqes;
+    void* sq_ring;
+    size_t sq_ring_size;
+    void* cq_ring;
+    size_t cq_ring_size;
+    size_t sqes_size;
+    unsigned sq_local_tail;     // Entradas preparadas, publicadas en ring_enter
+    unsigned to_submit;
+} Ring;
+
+// Archivo en vuelo
+typedef struct {
+    int index;
+    int fd;
+    char* data;
+    size_t size;
+    size_t got;
+} UringSlot;
+
+enum { OP_OPEN = 0, OP_READ = 1 };
+
+static int ring_setup(Ring* ring, unsigned entries) {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    memset(ring, 0, sizeof(*ring));
+    
+    ring->fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+    if (ring->fd < 0) return 0;
+    
+    ring->entries = params.sq_entries;
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+    ring->sqes = (struct io_uring_sqe*)mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+                                            MAP_SHARED | MAP_POPULATE, ring->fd,
+                                            IORING_OFF_SQES);
+    if (ring->sq_ring == MAP_FAILED || ring->cq_ring == MAP_FAILED ||
+        ring->sqes == MAP_FAILED) {
+        if (ring->sq_ring != MAP_FAILED) munmap(ring->sq_ring, ring->sq_ring_size);
+        if (ring->cq_ring != MAP_FAILED) munmap(ring->cq_ring, ring->cq_ring_size);
+        if (ring->sqes != MAP_FAILED) munmap(ring->sqes, ring->sqes_size);
+        close(ring->fd);
+        return 0;
+    }
+    
+    char* sq = (char*)ring->sq_ring;
+    ring->sq_head = (unsigned*)(sq + params.sq_off.head);
+    ring->sq_tail = (unsigned*)(sq + params.sq_off.tail);
+    ring->sq_mask = (unsigned*)(sq + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned*)(sq + params.sq_off.array);
+    ring->sq_local_tail = *ring->sq_tail;
+    
+    char* cq = (char*)ring->cq_ring;
+    ring->cq_head = (unsigned*)(cq + params.cq_off.head);
+    ring->cq_tail = (unsigned*)(cq + params.cq_off.tail);
+    ring->cq_mask = (unsigned*)(cq + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+    return 1;
+}
+
+static void ring_free(Ring* ring) {
+    munmap(ring->sqes, ring->sqes_size);
+    munmap(ring->cq_ring, ring->cq_ring_size);
+    munmap(ring->sq_ring, ring->sq_ring_size);
+    close(ring->fd);
+}
+
+// Verificar que el kernel soporta las operaciones usadas
+static int ring_supports(Ring* ring) {
+    size_t size = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+    struct io_uring_probe* probe = (struct io_uring_probe*)calloc(1, size);
+    if (probe == NULL) return 0;
+    
+    int ok = syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_PROBE, probe, 256) == 0 &&
+             probe->last_op >= IORING_OP_READ &&
+             (probe->ops[IORING_OP_OPENAT].flags & IO_URING_OP_SUPPORTED) &&
+             (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED);
+    free(probe);
+    return ok;
+}
+
+// Siguiente entrada libre de la cola de envío (siempre hay: nunca hay más
+// operaciones en vuelo que entradas)
+static struct io_uring_sqe* ring_sqe(Ring* ring) {
+    unsigned slot = ring->sq_local_tail & *ring->sq_mask;
+    struct io_uring_sqe* sqe = &ring->sqes[slot];
+    memset(sqe, 0, sizeof(*sqe));
+    ring->sq_array[slot] = slot;
+    ring->sq_local_tail++;
+    ring->to_submit++;
+    return sqe;
+}
+
+// Enviar lo pendiente y esperar al menos una finalización
+static int ring_enter(Ring* ring) {
+    __atomic_store_n(ring->sq_tail, ring->sq_local_tail, __ATOMIC_RELEASE);
+
+#ifdef LOADER_FAULT_ENTER
+    // Pruebas (tests/test_loader.c): el envío número LOADER_FAULT_ENTER
+    // falla como si el kernel lo rechazara
+    static int enter_calls = 0;
+    if (++enter_calls == LOADER_FAULT_ENTER) {
+        errno = EBADF;
+        return 0;
+    }
+#endif
+
+    for (;;) {
+        long result = syscall(__NR_io_uring_enter, ring->fd, ring->to_submit, 1,
+                              IORING_ENTER_GETEVENTS, NULL, 0);
+        if (result >= 0) {
+            ring->to_submit -= (unsigned)result;
+            return 1;
+        }
+        if (errno != EINTR && errno != EAGAIN && errno != EBUSY) return 0;
+    }
+}
+
+static void uring_open(Ring* ring, UringSlot* slots, int slot, const char* path) {
+    struct io_uring_sqe* sqe = ring_sqe(ring);
+    sqe->opcode = IORING_OP_OPENAT;
+    sqe->fd = AT_FDCWD;
+    sqe->addr = (unsigned long)path;
+    sqe->open_flags = O_RDONLY | O_CLOEXEC;
+    sqe->user_data = ((unsigned long long)slot << 1) | OP_OPEN;
+    slots[slot].fd = -1;
+    slots[slot].data = NULL;
+}
+
+static void uring_read(Ring* ring, UringSlot* slot, int number) {
+    size_t remaining = slot->size - slot->got;
+    if (remaining > (1u << 30)) remaining = 1u << 30;
+    
+    struct io_uring_sqe* sqe = ring_sqe(ring);
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = slot->fd;
+    sqe->addr = (unsigned long)(slot->data + slot->got);
+    sqe->len = (unsigned)remaining;
+    sqe->off = slot->got;
+    sqe->user_data = ((unsigned long long)number << 1) | OP_READ;
+}
+
+// Terminar un archivo y entregarlo
+static void uring_finish(UringSlot* slot, LoadStatus status,
+                         LoaderDeliver deliver, void* context) {
+    if (slot->fd >= 0) close(slot->fd);
+    slot->fd = -1;
+    
+    LoadedFile file;
+    file.index = slot->index;
+    file.status = status;
+    file.data = NULL;
+    file.length = 0;
+    
+    if (status == LOAD_OK) {
+        slot->data[slot->got] = '\0';
+        file.data = slot->data;
+        file.length = slot->got;
+    } else {
+        free(slot->data);
+    }
+    slot->data = NULL;
+    deliver(context, &file);
+}
+
+// Procesar una finalización. Retorna 1 si el archivo terminó.
+static int uring_complete(Ring* ring, UringSlot* slots, struct io_uring_cqe* cqe,
+                          LoaderDeliver deliver, void* context) {
+    int number = (int)(cqe->user_data >> 1);
+    int op = (int)(cqe->user_data & 1);
+    UringSlot* slot = &slots[number];
+    
+    if (op == OP_OPEN) {
+        struct stat info;
+        if (cqe->res < 0) {
+            uring_finish(slot, LOAD_OPEN_FAILED, deliver, context);
+            return 1;
+        }
+        
+        // El inodo ya está en memoria tras abrir: fstat no espera disco
+        slot->fd = cqe->res;
+        if (fstat(slot->fd, &info) != 0) {
+            uring_finish(slot, LOAD_OPEN_FAILED, deliver, context);
+            return 1;
+        }
+        
+        slot->size = (size_t)info.st_size;
+        slot->got = 0;
+        slot->data = (char*)malloc(slot->size + 1);
+        if (slot->data == NULL) {
+            uring_finish(slot, LOAD_NO_MEMORY, deliver, context);
+            return 1;
+        }
+        if (slot->size == 0) {
+            uring_finish(slot, LOAD_OK, deliver, context);
+            return 1;
+        }
+        
+        uring_read(ring, slot, number);
+        return 0;
+    }
+    
+    if (cqe->res == -EINTR || cqe->res == -EAGAIN) {
+        uring_read(ring, slot, number);
+        return 0;
+    }
+    if (cqe->res <= 0) {
+        // Error o fin de archivo antes del tamaño esperado
+        uring_finish(slot, LOAD_READ_FAILED, deliver, context);
+        return 1;
+    }
+    
+    slot->got += (size_t)cqe->res;
+    if (slot->got < slot->size) {
+        uring_read(ring, slot, number);
+        return 0;
+    }
+    
+    uring_finish(slot, LOAD_OK, deliver, context);
+    return 1;
+}
+
+static int load_uring(char** paths, int count, LoaderDeliver deliver, void* context) {
+    Ring ring;
+    if (!ring_setup(&ring, LOADER_URING_DEPTH)) return 0;
+    if (!ring_supports(&ring) || ring.entries < LOADER_URING_DEPTH) {
+        ring_free(&ring);
+        return 0;
+    }
+    
+    UringSlot slots[LOADER_URING_DEPTH];
+    int free_slots[LOADER_URING_DEPTH];
+    int free_count = LOADER_URING_DEPTH;
+    for (int i = 0; i < LOADER_URING_DEPTH; i++) {
+        free_slots[i] = LOADER_URING_DEPTH - 1 - i;
+    }
+    
+    int next = 0;
+    int active = 0;
+    while (next < count || active > 0) {
+        // Mantener la cola llena
+        while (free_count > 0 && next < count) {
+            int slot = free_slots[--free_count];
+            slots[slot].index = next;
+            uring_open(&ring, slots, slot, paths[next]);
+            next++;
+            active++;
+        }
+        
+        if (!ring_enter(&ring)) {
+            // El kernel rechazó el envío: se cierran los descriptores ya
+            // abiertos y el anillo, y los archivos en vuelo se cargan de
+            // nuevo sin io_uring. Sus buffers pueden seguir en uso por una
+            // lectura pendiente, así que no se liberan.
+            int in_flight[LOADER_URING_DEPTH];
+            for (int i = 0; i < LOADER_URING_DEPTH; i++) in_flight[i] = 1;
+            for (int j = 0; j < free_count; j++) in_flight[free_slots[j]] = 0;
+            
+            for (int i = 0; i < LOADER_URING_DEPTH; i++) {
+                if (in_flight[i] && slots[i].fd >= 0) close(slots[i].fd);
+            }
+            
+            // Aperturas que ya terminaron pero no se procesaron
+            unsigned head = *ring.cq_head;
+            unsigned tail = __atomic_load_n(ring.cq_tail, __ATOMIC_ACQUIRE);
+            for (; head != tail; head++) {
+                struct io_uring_cqe* cqe = &ring.cqes[head & *ring.cq_mask];
+                if ((cqe->user_data & 1) == OP_OPEN && cqe->res >= 0) close(cqe->res);
+            }
+            ring_free(&ring);
+            
+            for (int i = 0; i < LOADER_URING_DEPTH; i++) {
+                if (!in_flight[i]) continue;
+                
+                LoadedFile file;
+                file.index = slots[i].index;
+                load_one(paths[file.index], &file);
+                deliver(context, &file);
+            }
+            load_sync(paths, next, count, deliver, context);
+            return 1;
+        }
+        
+        unsigned head = *ring.cq_head;
+        unsigned tail = __atomic_load_n(ring.cq_tail, __ATOMIC_ACQUIRE);
+        while (head != tail) {
+            struct io_uring_cqe* cqe = &ring.cqes[head & *ring.cq_mask];
+            int slot = (int)(cqe->user_data >> 1);
+            if (uring_complete(&ring, slots, cqe, deliver, context)) {
+                free_slots[free_count++] = slot;
+                active--;
+            }
+            head++;
+        }
+        __atomic_store_n(ring.cq_head, head, __ATOMIC_RELEASE);
+    }
+    
+    ring_free(&ring);
+    return 1;
+}
+
+#endif
+
+LoaderKind loader_run(LoaderKind kind, char** paths, int count,
+                      LoaderDeliver deliver, void* context) {
+#ifdef LOADER_HAVE_URING
+    if (kind == LOADER_AUTO || kind == LOADER_URING) {
+        if (load_uring(paths, count, deliver, context)) return LOADER_URING;
+        kind = LOADER_THREADS;
+    }
+#endif
+
+#ifndef _WIN32
+    if (kind != LOADER_SYNC) {
+        load_threads(paths, count, deliver, context);
+        return LOADER_THREADS;
+    }
+#endif
+
+    load_sync(paths, 0, count, deliver, context);
+    return LOADER_SYNC;
+}
@@ -0,0 +1,55 @@
+#ifndef LOADER_H
+#define LOADER_H
+
+#include <stddef.h>
+
+// Carga de muchos archivos a la vez para la validación por lotes
+// (--batch). Las lecturas se solapan entre sí en lugar de hacerse una
+// tras otra, y cada archivo se entrega en cuanto termina de leerse.
+//
+//   LOADER_URING:   io_uring (Linux 5.6+): un solo hilo mantiene hasta
+//                   LOADER_URING_DEPTH archivos en vuelo (openat + read)
+//   LOADER_THREADS: LOADER_THREAD_COUNT hilos con open/read bloqueantes
+//   LOADER_SYNC:    un archivo tras otro (como read_file)
+//   LOADER_AUTO:    io_uring si el kernel lo permite, si no hilos
+
+typedef enum {
+    LOADER_AUTO,
+    LOADER_URING,
+    LOADER_THREADS,
+    LOADER_SYNC
+} LoaderKind;
+
+#define LOADER_URING_DEPTH 64
+#define LOADER_THREAD_COUNT 16
+
+// Resultado de la carga de un archivo
+typedef enum {
+    LOAD_OK,
+    LOAD_OPEN_FAILED,
+    LOAD_READ_FAILED,
+    LOAD_NO_MEMORY
+} LoadStatus;
+
+typedef struct {
+    int index;          // Posición en la lista de rutas
+    LoadStatus status;
+    char* data;         // Contenido terminado en '\0' (NULL si falló)
+    size_t length;
+} LoadedFile;
+
+// Recibe cada archivo cargado, en cualquier orden y desde el hilo del
+// cargador; pasa a ser dueño de file->data. Puede bloquear para limitar
+// cuántos archivos cargados esperan.
+typedef void (*LoaderDeliver)(void* context, LoadedFile* file);
+
+// Cargar los 'count' archivos de 'paths' y entregarlos a 'deliver'.
+// Retorna el cargador usado (LOADER_AUTO se resuelve a uno concreto;
+// LOADER_URING sin soporte del kernel pasa a LOADER_THREADS).
+LoaderKind loader_run(LoaderKind kind, char** paths, int count,
+                      LoaderDeliver deliver, void* context);
+
+// Nombre del cargador (para --stats y mensajes)
+const char* loader_name(LoaderKind kind);
+
+#endif
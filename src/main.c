@@ -4,71 +4,405 @@
 #include <string.h>
 #include "lexer.h"
 #include "parser.h"
+#include "cache.h"
+#include "source.h"
+#include "server.h"
+#include "token_stream.h"
+#include "parallel.h"
+#include "push_parser.h"
+#include "batch.h"
 
-// Leer archivo completo a un string
-static char* read_file(const char* path) {
-    FILE* file = fopen(path, "rb");
+#ifdef _WIN32
+#include <windows.h>
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <time.h>
+#endif
+
+// Reloj monotono en segundos (para --stats)
+static double now_seconds(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return (double)count.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+#endif
+}
+
+// Fase lexica aislada: recorre todos los tokens sin parser (para --stats)
+static void lex_only_pass(const char* source, size_t length) {
+    Lexer lexer;
+    lexer_init(&lexer, source);
+    lexer.padded = 1;
+    lexer.end = source + length;
+    
+    for (;;) {
+        Token token = lexer_next_token(&lexer);
+        TokenType type = token.type;
+        token_free(&token);
+        if (type == TOKEN_EOF) break;
+    }
+}
+
+static void print_stats(const double* times, const Stats* stats, int cache_hit) {
+    fprintf(stderr, "=== Estadisticas ===\n");
+    if (cache_hit) {
+        fprintf(stderr, "Resultado desde cache (sin lexico ni sintactico)\n");
+    }
+    fprintf(stderr, "Fases (reloj monotono):\n");
+    fprintf(stderr, "  lectura:    %10.3f ms\n", times[0] * 1000.0);
+    fprintf(stderr, "  sintactico: %10.3f ms (incluye lexico)\n", times[2] * 1000.0);
+    fprintf(stderr, "  total:      %10.3f ms\n", (times[0] + times[2]) * 1000.0);
+    if (!cache_hit) {
+        // Pasada aparte solo para medir; no está en el total ni en los contadores
+        fprintf(stderr, "  lexico aislado: %6.3f ms (pasada aparte, fuera del total)\n",
+                times[1] * 1000.0);
+    }
+
+#ifdef MINI0_STATS
+    unsigned long total = 0;
+    for (int i = 0; i <= TOKEN_ERROR; i++) total += stats->tokens[i];
     
-    if (file == NULL) {
-        fprintf(stderr, "Error: No se pudo abrir el archivo '%s'\n", path);
-        return NULL;
+    fprintf(stderr, "Contadores:\n");
+    fprintf(stderr, "  tokens: %lu\n", total);
+    for (int i = 0; i <= TOKEN_ERROR; i++) {
+        if (stats->tokens[i] == 0) continue;
+        fprintf(stderr, "    %-12s %lu\n",
+                token_type_name((TokenType)i), stats->tokens[i]);
+    }
+    fprintf(stderr, "  reservas (make_token/scan_string): %lu (%lu bytes)\n",
+            stats->allocations, (unsigned long)stats->bytes_allocated);
+    fprintf(stderr, "  profundidad maxima de expression: %d\n", stats->max_expr_depth);
+    fprintf(stderr, "  profundidad maxima de bloque: %d\n", stats->max_block_depth);
+    fprintf(stderr, "  recuperaciones (synchronize): %lu\n", stats->recoveries);
+#else
+    (void)stats;
+    fprintf(stderr, "Contadores deshabilitados (compilar con -DMINI0_STATS)\n");
+#endif
+}
+
+// Reproducir un resultado guardado en el cache: mismos diagnosticos
+// y mismo mensaje que un analisis completo. Retorna el exito guardado.
+static int replay_result(const CacheFile* file) {
+    fwrite(file->diagnostics, 1, file->diagnostics_length, stderr);
+    if (file->success) {
+        printf("Analisis sintactico exitoso!\n");
+    }
+    return file->success;
+}
+
+// Analizar la entrada estándar por partes a medida que llega, sin leerla
+// completa en memoria
+static int check_stdin(void) {
+#ifdef _WIN32
+    _setmode(_fileno(stdin), _O_BINARY);
+#endif
+    PushParser* push = push_parser_new(NULL);
+    if (push == NULL) {
+        fprintf(stderr, "Error: Memoria insuficiente\n");
+        return 1;
     }
     
-    // Obtener tamaño del archivo
-    fseek(file, 0L, SEEK_END);
-    size_t file_size = ftell(file);
-    rewind(file);
+    char chunk[64 * 1024];
+    size_t count;
+    int ok = 1;
+    while (ok && (count = fread(chunk, 1, sizeof(chunk), stdin)) > 0) {
+        ok = push_parser_feed(push, chunk, count);
+    }
     
-    // Reservar memoria
-    char* buffer = (char*)malloc(file_size + 1);
-    if (buffer == NULL) {
-        fprintf(stderr, "Error: No hay memoria suficiente para leer '%s'\n", path);
-        fclose(file);
-        return NULL;
+    int success = push_parser_finish(push);
+    if (!ok) {
+        fprintf(stderr, "Error: Memoria insuficiente\n");
+        success = 0;
+    } else if (ferror(stdin)) {
+        fprintf(stderr, "Error: No se pudo leer la entrada estandar\n");
+        success = 0;
     }
+    push_parser_free(push);
     
-    // Leer archivo
-    size_t bytes_read = fread(buffer, sizeof(char), file_size, file);
-    if (bytes_read < file_size) {
-        fprintf(stderr, "Error: No se pudo leer el archivo '%s'\n", path);
-        free(buffer);
-        fclose(file);
-        return NULL;
+    if (success) {
+        printf("Analisis sintactico exitoso!\n");
+        return 0;
+    }
+    return 1;
+}
+
+// --batch: leer la lista (una ruta por línea) y analizar todos los archivos
+static int check_batch(const char* list_path, LoaderKind loader, int workers, int show_stats) {
+    size_t length = 0;
+    char* list = read_file(list_path, &length);
+    if (list == NULL) {
+        return 1;
     }
     
-    buffer[bytes_read] = '\0';
-    fclose(file);
+    int capacity = 1024;
+    int count = 0;
+    char** paths = (char**)malloc(sizeof(char*) * (size_t)capacity);
+    char* line = list;
+    while (paths != NULL && line < list + length) {
+        char* newline = strchr(line, '\n');
+        char* next = newline != NULL ? newline + 1 : list + length;
+        if (newline != NULL) *newline = '\0';
+        size_t line_length = strlen(line);
+        if (line_length > 0 && line[line_length - 1] == '\r') line[--line_length] = '\0';
+        
+        if (line_length > 0) {
+            if (count == capacity) {
+                capacity *= 2;
+                char** grown = (char**)realloc(paths, sizeof(char*) * (size_t)capacity);
+                if (grown == NULL) {
+                    free(paths);
+                    paths = NULL;
+                    break;
+                }
+                paths = grown;
+            }
+            paths[count++] = line;
+        }
+        line = next;
+    }
     
-    return buffer;
+    int failed = paths != NULL ? batch_check(paths, count, loader, workers, show_stats)
+                               : BATCH_NO_MEMORY;
+    if (failed == BATCH_NO_MEMORY) {
+        fprintf(stderr, "Error: Memoria insuficiente\n");
+    } else if (failed == BATCH_NO_THREADS) {
+        fprintf(stderr, "Error: No se pudieron crear los hilos de --batch\n");
+    }
+    free(paths);
+    free(list);
+    return failed != 0 ? 1 : 0;
+}
+
+static void usage(const char* program) {
+    fprintf(stderr, "Uso: %s [--stats] [--cache] [--profile <salida.folded>] [--jobs <n>] "
+                    "<archivo.mini0>\n", program);
+    fprintf(stderr, "     %s -   (fuente desde la entrada estandar)\n", program);
+    fprintf(stderr, "     %s --batch <lista.txt> [--loader uring|threads|sync] [--jobs <n>] "
+                    "[--stats]\n", program);
+    fprintf(stderr, "     %s --lex-only|--lex-binary <archivo.mini0>\n", program);
+    fprintf(stderr, "     %s --server <socket>\n", program);
+    fprintf(stderr, "     %s --connect <socket> <archivo.mini0>\n", program);
+    fprintf(stderr, "--profile escribe pilas en formato folded; cada muestra es un token "
+                    "consumido, no tiempo\n");
 }
 
 int main(int argc, char* argv[]) {
-    if (argc != 2) {
-        fprintf(stderr, "Uso: %s <archivo.mini0>\n", argv[0]);
+    const char* path = NULL;
+    int show_stats = 0;
+    int use_cache = 0;
+    const char* server_socket = NULL;
+    const char* connect_socket = NULL;
+    int lex_only = 0;
+    TokenStreamFormat lex_format = TOKEN_STREAM_JSON;
+    const char* profile_out = NULL;
+    int jobs = 1;
+    const char* batch_list = NULL;
+    LoaderKind loader = LOADER_AUTO;
+    
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--stats") == 0) {
+            show_stats = 1;
+        } else if (strcmp(argv[i], "--cache") == 0) {
+            use_cache = 1;
+        } else if (strcmp(argv[i], "--lex-only") == 0) {
+            lex_only = 1;
+            lex_format = TOKEN_STREAM_JSON;
+        } else if (strcmp(argv[i], "--lex-binary") == 0) {
+            lex_only = 1;
+            lex_format = TOKEN_STREAM_BINARY;
+        } else if (strcmp(argv[i], "--profile") == 0 && i + 1 < argc) {
+            profile_out = argv[++i];
+        } else if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc) {
+            jobs = atoi(argv[++i]);
+            if (jobs < 1 || jobs > PARALLEL_MAX_JOBS) {
+                fprintf(stderr, "Error: --jobs debe estar entre 1 y %d\n", PARALLEL_MAX_JOBS);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--batch") == 0 && i + 1 < argc) {
+            batch_list = argv[++i];
+        } else if (strcmp(argv[i], "--loader") == 0 && i + 1 < argc) {
+            const char* name = argv[++i];
+            if (strcmp(name, "uring") == 0) {
+                loader = LOADER_URING;
+            } else if (strcmp(name, "threads") == 0) {
+                loader = LOADER_THREADS;
+            } else if (strcmp(name, "sync") == 0) {
+                loader = LOADER_SYNC;
+            } else {
+                fprintf(stderr, "Error: --loader debe ser uring, threads o sync\n");
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--server") == 0 && i + 1 < argc) {
+            server_socket = argv[++i];
+        } else if (strcmp(argv[i], "--connect") == 0 && i + 1 < argc) {
+            connect_socket = argv[++i];
+        } else if (path == NULL) {
+            path = argv[i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    
+    if (server_socket != NULL) {
+        return server_run(server_socket);
+    }
+    
+    if (batch_list != NULL) {
+        if (path != NULL) {
+            usage(argv[0]);
+            return 1;
+        }
+        return check_batch(batch_list, loader, jobs, show_stats);
+    }
+    
+    if (path == NULL) {
+        usage(argv[0]);
         return 1;
     }
     
+    // "-": fuente por partes desde la entrada estándar
+    if (strcmp(path, "-") == 0) {
+        return check_stdin();
+    }
+    
+    // Cliente ligero: el servidor analiza y conserva los resultados
+    if (connect_socket != NULL) {
+        int status = client_run(connect_socket, path);
+        if (status == 0) {
+            printf("Analisis sintactico exitoso!\n");
+        }
+        return status;
+    }
+    
+    // Tiempos por fase: lectura, lexico, sintactico
+    double times[3] = {0.0, 0.0, 0.0};
+    Stats stats;
+    memset(&stats, 0, sizeof(stats));
+    
     // Leer archivo fuente
-    char* source = read_file(argv[1]);
+    double t0 = now_seconds();
+    size_t source_length = 0;
+    char* source = read_file(path, &source_length);
+    times[0] = now_seconds() - t0;
     if (source == NULL) {
         return 1;
     }
     
+    // Solo tokens: sin parser, cache ni mensaje de exito en stdout
+    if (lex_only) {
+#ifdef _WIN32
+        if (lex_format == TOKEN_STREAM_BINARY) {
+            _setmode(_fileno(stdout), _O_BINARY);
+        }
+#endif
+        int status = token_stream_write(source, source_length, lex_format, stdout);
+        if (status == 2) {
+            fprintf(stderr, "Error: No se pudo escribir el flujo de tokens\n");
+        }
+        free(source);
+        return status != 0;
+    }
+    
+    // Con --cache, un fuente sin cambios reutiliza el resultado guardado
+    // (salvo con --profile, que necesita analizar el fuente)
+    uint64_t hash = 0;
+    if (use_cache && profile_out == NULL) {
+        t0 = now_seconds();
+        hash = cache_hash(source, source_length);
+        
+        CacheFile cached;
+        if (cache_open(&cached, cache_dir(), hash, source, source_length)) {
+            int success = replay_result(&cached);
+            cache_close(&cached);
+            free(source);
+            times[2] = now_seconds() - t0;
+            
+            if (show_stats) {
+                print_stats(times, &stats, 1);
+            }
+            return success ? 0 : 1;
+        }
+    }
+    
+    if (show_stats) {
+        t0 = now_seconds();
+        lex_only_pass(source, source_length);
+        times[1] = now_seconds() - t0;
+    }
+    
     // Inicializar lexer
     Lexer lexer;
     lexer_init(&lexer, source);
+    lexer.padded = 1;
+    lexer.end = source + source_length;
+    if (show_stats) {
+        lexer.stats = &stats;
+    }
     
     // Inicializar parser
+    t0 = now_seconds();
     Parser parser;
     parser_init(&parser, &lexer);
     
+    Diagnostics diagnostics;
+    diagnostics_init(&diagnostics);
+    if (use_cache) {
+        parser.diagnostics = &diagnostics;
+    }
+    
+    Profile profile;
+    if (profile_out != NULL) {
+        profile_init(&profile);
+        parser.profile = &profile;
+    }
+    
+    // Con --jobs se analizan las funciones en paralelo; si algún fragmento
+    // tiene errores se analiza todo en secuencia para reportarlos igual
+    // que sin --jobs. --stats y --profile necesitan el análisis secuencial.
+    int success = 0;
+    if (jobs > 1 && !show_stats && profile_out == NULL) {
+        success = parallel_check(source, source_length, jobs);
+    }
+    
     // Parsear
-    int success = parser_parse(&parser);
+    if (!success) {
+        success = parser_parse(&parser);
+    }
+    times[2] = now_seconds() - t0;
+    
+    if (use_cache) {
+        fwrite(diagnostics.text, 1, diagnostics.length, stderr);
+        if (profile_out != NULL) hash = cache_hash(source, source_length);
+        cache_store(cache_dir(), hash, source, source_length,
+                    success, diagnostics.count, diagnostics.text, diagnostics.length);
+    }
+    
+    if (profile_out != NULL) {
+        FILE* out = fopen(profile_out, "w");
+        if (out == NULL || !profile_write_folded(&profile, out)) {
+            fprintf(stderr, "Error: No se pudo escribir el perfil '%s'\n", profile_out);
+            success = 0;
+        }
+        if (out != NULL) fclose(out);
+        profile_free(&profile);
+    }
     
     // Liberar recursos
     parser_free(&parser);
+    diagnostics_free(&diagnostics);
     free(source);
     
+    if (show_stats) {
+        print_stats(times, &stats, 0);
+    }
+    
     if (success) {
         printf("Analisis sintactico exitoso!\n");
         return 0;
@@ -0,0 +1,163 @@
+// mini0.c
+#include "mini0.h"
+#include "arena.h"
+#include "lexer.h"
+#include "parser.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+struct Mini0Result {
+    int success;
+    int error_count;
+    size_t diagnostics_length;
+    char diagnostics[];
+};
+
+// Contexto de cada hilo: se reutiliza entre llamadas
+typedef struct {
+    Arena arena;                // Copia del fuente y lexemas de los tokens
+    Diagnostics diagnostics;
+} ThreadContext;
+
+// ==================== CONTEXTO POR HILO ====================
+
+static void context_destroy(void* pointer) {
+    ThreadContext* context = (ThreadContext*)pointer;
+    if (context == NULL) return;
+    
+    arena_free(&context->arena);
+    diagnostics_free(&context->diagnostics);
+    free(context);
+}
+
+static ThreadContext* context_create(void) {
+    ThreadContext* context = (ThreadContext*)malloc(sizeof(ThreadContext));
+    if (context == NULL) return NULL;
+    
+    arena_init(&context->arena);
+    diagnostics_init(&context->diagnostics);
+    return context;
+}
+
+#ifdef _WIN32
+
+static INIT_ONCE context_once = INIT_ONCE_STATIC_INIT;
+static DWORD context_slot = FLS_OUT_OF_INDEXES;
+
+static void WINAPI context_destroy_fls(void* pointer) {
+    context_destroy(pointer);
+}
+
+static BOOL CALLBACK context_slot_init(PINIT_ONCE once, void* parameter, void** out) {
+    (void)once;
+    (void)parameter;
+    (void)out;
+    context_slot = FlsAlloc(context_destroy_fls);
+    return context_slot != FLS_OUT_OF_INDEXES;
+}
+
+static ThreadContext* thread_context(void) {
+    if (!InitOnceExecuteOnce(&context_once, context_slot_init, NULL, NULL)) return NULL;
+    
+    ThreadContext* context = (ThreadContext*)FlsGetValue(context_slot);
+    if (context == NULL) {
+        context = context_create();
+        if (context != NULL) FlsSetValue(context_slot, context);
+    }
+    return context;
+}
+
+#else
+
+static pthread_once_t context_once = PTHREAD_ONCE_INIT;
+static pthread_key_t context_key;
+static int context_key_ok = 0;
+
+static void context_key_init(void) {
+    context_key_ok = pthread_key_create(&context_key, context_destroy) == 0;
+}
+
+static ThreadContext* thread_context(void) {
+    pthread_once(&context_once, context_key_init);
+    if (!context_key_ok) return NULL;
+    
+    ThreadContext* context = (ThreadContext*)pthread_getspecific(context_key);
+    if (context == NULL) {
+        context = context_create();
+        if (context != NULL) pthread_setspecific(context_key, context);
+    }
+    return context;
+}
+
+#endif
+
+// ==================== ANALISIS ====================
+
+static Mini0Result* make_result(int success, int error_count,
+                                const char* diagnostics, size_t length) {
+    Mini0Result* result = (Mini0Result*)malloc(sizeof(Mini0Result) + length + 1);
+    if (result == NULL) return NULL;
+    
+    result->success = success;
+    result->error_count = error_count;
+    result->diagnostics_length = length;
+    if (length > 0) memcpy(result->diagnostics, diagnostics, length);
+    result->diagnostics[length] = '\0';
+    return result;
+}
+
+Mini0Result* mini0_check(const char* source, size_t length) {
+    ThreadContext* context = thread_context();
+    if (context == NULL) return NULL;
+    
+    arena_reset(&context->arena);
+    context->diagnostics.length = 0;
+    context->diagnostics.count = 0;
+    
+    // El lexer necesita el fuente terminado en '\0' (y SIMD_PAD bytes más
+    // para la búsqueda vectorial)
+    char* copy = (char*)arena_alloc(&context->arena, length + 1 + SIMD_PAD);
+    if (copy == NULL) return NULL;
+    memcpy(copy, source, length);
+    memset(copy + length, 0, 1 + SIMD_PAD);
+    
+    Lexer lexer;
+    lexer_init(&lexer, copy);
+    lexer.padded = 1;
+    lexer.end = copy + length;
+    lexer.arena = &context->arena;
+    
+    Parser parser;
+    parser_init(&parser, &lexer);
+    parser.diagnostics = &context->diagnostics;
+    
+    int success = parser_parse(&parser);
+    parser_free(&parser);
+    
+    return make_result(success, parser.error_count,
+                       context->diagnostics.text, context->diagnostics.length);
+}
+
+int mini0_result_ok(const Mini0Result* result) {
+    return result->success;
+}
+
+int mini0_result_error_count(const Mini0Result* result) {
+    return result->error_count;
+}
+
+const char* mini0_result_diagnostics(const Mini0Result* result, size_t* length) {
+    if (length != NULL) *length = result->diagnostics_length;
+    return result->diagnostics;
+}
+
+void mini0_result_free(Mini0Result* result) {
+    free(result);
+}
@@ -0,0 +1,33 @@
+#ifndef MINI0_H
+#define MINI0_H
+
+#include <stddef.h>
+
+// libmini0: verificación sintáctica de Mini-0 en memoria, para incrustar
+// el analizador en otro programa sin lanzar un proceso por fuente.
+//
+// No hay estado global mutable: cada hilo usa su propio contexto (arena
+// para los tokens y buffer de diagnósticos), creado en la primera llamada
+// del hilo, reutilizado en las siguientes y liberado al terminar el hilo.
+// Se puede llamar a mini0_check desde muchos hilos a la vez.
+
+typedef struct Mini0Result Mini0Result;
+
+// Analizar 'length' bytes de 'source' (no necesita terminar en '\0').
+// Retorna NULL solo si no hay memoria. El resultado es independiente del
+// hilo que lo creó y se libera con mini0_result_free.
+Mini0Result* mini0_check(const char* source, size_t length);
+
+// 1 si el fuente es sintácticamente correcto
+int mini0_result_ok(const Mini0Result* result);
+
+// Número de errores reportados
+int mini0_result_error_count(const Mini0Result* result);
+
+// Diagnósticos con el mismo texto que imprime el ejecutable ("" si no hay
+// errores), terminados en '\0'. Si 'length' no es NULL recibe su longitud.
+const char* mini0_result_diagnostics(const Mini0Result* result, size_t* length);
+
+void mini0_result_free(Mini0Result* result);
+
+#endif
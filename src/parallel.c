@@ -0,0 +1,162 @@
+// parallel.c
+#include "parallel.h"
+#include "mini0.h"
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+typedef struct {
+    const char* start;
+    size_t length;
+    int ok;
+} Chunk;
+
+// ==================== DIVISIÓN EN FRAGMENTOS ====================
+
+static int is_ident_char(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           (c >= '0' && c <= '9') || c == '_';
+}
+
+// 'p' está al inicio de una línea que empieza con la palabra 'fun'
+static int is_fun_line(const char* p, const char* end) {
+    return end - p > 3 && p[0] == 'f' && p[1] == 'u' && p[2] == 'n' &&
+           !is_ident_char(p[3]);
+}
+
+// Calcular los cortes: recorre el fuente siguiendo strings y comentarios
+// como el lexer, y en cada línea 'fun' a partir de la posición objetivo
+// del siguiente fragmento hace un corte. Retorna el número de fragmentos.
+static int split_chunks(const char* source, size_t length, int jobs, Chunk* chunks) {
+    const char* p = source;
+    const char* end = source + length;
+    const char* chunk_start = source;
+    int count = 0;
+    
+    while (p < end && count < jobs - 1) {
+        char c = *p;
+        
+        if (c == '"') {
+            // String: termina en '"' o en el salto de línea (error léxico)
+            p++;
+            while (p < end && *p != '"' && *p != '\n') {
+                if (*p == '\\' && p + 1 < end && p[1] != '\n') p++;
+                p++;
+            }
+            if (p < end && *p == '"') p++;
+        } else if (c == '/' && p + 1 < end && p[1] == '/') {
+            // Comentario de línea: el salto de línea se procesa abajo
+            while (p < end && *p != '\n') p++;
+        } else if (c == '/' && p + 1 < end && p[1] == '*') {
+            // Comentario de bloque
+            p += 2;
+            while (p < end && !(*p == '*' && p + 1 < end && p[1] == '/')) p++;
+            p = p < end ? p + 2 : end;
+        } else if (c == '\n') {
+            p++;
+            size_t target = length / (size_t)jobs * (size_t)(count + 1);
+            if ((size_t)(p - source) >= target && is_fun_line(p, end)) {
+                chunks[count].start = chunk_start;
+                chunks[count].length = (size_t)(p - chunk_start);
+                count++;
+                chunk_start = p;
+            }
+        } else {
+            p++;
+        }
+    }
+    
+    chunks[count].start = chunk_start;
+    chunks[count].length = (size_t)(end - chunk_start);
+    return count + 1;
+}
+
+// ==================== HILOS ====================
+
+static void check_chunk(Chunk* chunk) {
+    Mini0Result* result = mini0_check(chunk->start, chunk->length);
+    chunk->ok = result != NULL && mini0_result_ok(result);
+    mini0_result_free(result);
+}
+
+#ifdef _WIN32
+
+static DWORD WINAPI chunk_thread(void* argument) {
+    check_chunk((Chunk*)argument);
+    return 0;
+}
+
+static int run_chunks(Chunk* chunks, int count) {
+    HANDLE threads[PARALLEL_MAX_JOBS];
+    int started = 0;
+    int ok = 1;
+    
+    // El fragmento 0 lo analiza el hilo actual
+    for (int i = 1; i < count; i++) {
+        threads[i] = CreateThread(NULL, 0, chunk_thread, &chunks[i], 0, NULL);
+        if (threads[i] == NULL) {
+            ok = 0;
+            break;
+        }
+        started = i;
+    }
+    
+    if (ok) check_chunk(&chunks[0]);
+    
+    for (int i = 1; i <= started; i++) {
+        WaitForSingleObject(threads[i], INFINITE);
+        CloseHandle(threads[i]);
+    }
+    return ok;
+}
+
+#else
+
+static void* chunk_thread(void* argument) {
+    check_chunk((Chunk*)argument);
+    return NULL;
+}
+
+static int run_chunks(Chunk* chunks, int count) {
+    pthread_t threads[PARALLEL_MAX_JOBS];
+    int started = 0;
+    int ok = 1;
+    
+    // El fragmento 0 lo analiza el hilo actual
+    for (int i = 1; i < count; i++) {
+        if (pthread_create(&threads[i], NULL, chunk_thread, &chunks[i]) != 0) {
+            ok = 0;
+            break;
+        }
+        started = i;
+    }
+    
+    if (ok) check_chunk(&chunks[0]);
+    
+    for (int i = 1; i <= started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    return ok;
+}
+
+#endif
+
+int parallel_check(const char* source, size_t length, int jobs) {
+    if (jobs > PARALLEL_MAX_JOBS) jobs = PARALLEL_MAX_JOBS;
+    if (jobs < 1) jobs = 1;
+    
+    Chunk chunks[PARALLEL_MAX_JOBS];
+    memset(chunks, 0, sizeof(chunks));
+    
+    int count = split_chunks(source, length, jobs, chunks);
+    if (!run_chunks(chunks, count)) return 0;
+    
+    for (int i = 0; i < count; i++) {
+        if (!chunks[i].ok) return 0;
+    }
+    return 1;
+}
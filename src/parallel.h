@@ -0,0 +1,26 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <stddef.h>
+
+// Análisis en paralelo por funciones (--jobs).
+//
+// El fuente se divide en 'jobs' fragmentos contiguos, cortados solo en
+// líneas que empiezan con 'fun' fuera de strings y comentarios. Cada
+// fragmento es una secuencia de declaraciones completa, así que el
+// programa es correcto si y solo si todos los fragmentos lo son. Cada
+// fragmento se analiza en su propio hilo con mini0_check.
+//
+// Si algún fragmento tiene errores el resultado no sirve para reportarlos
+// (la recuperación y las líneas dependen del fuente completo): el llamador
+// debe analizar todo el fuente en secuencia para obtener los mismos
+// diagnósticos que sin --jobs.
+
+// Número máximo de hilos
+#define PARALLEL_MAX_JOBS 64
+
+// Retorna 1 si todos los fragmentos son correctos, 0 si alguno tiene
+// errores o no se pudo crear un hilo.
+int parallel_check(const char* source, size_t length, int jobs);
+
+#endif
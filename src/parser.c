@@ -1,41 +1,97 @@
 #include "parser.h"
+#include "hints.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdarg.h>
 
 // ==================== UTILIDADES ====================
 
-static void error_at(Parser* parser, Token* token, const char* message) {
+void diagnostics_init(Diagnostics* diagnostics) {
+    diagnostics->text = NULL;
+    diagnostics->length = 0;
+    diagnostics->capacity = 0;
+    diagnostics->count = 0;
+}
+
+void diagnostics_free(Diagnostics* diagnostics) {
+    free(diagnostics->text);
+    diagnostics_init(diagnostics);
+}
+
+// Escribir texto de diagnostico en stderr o en el buffer del parser
+COLD static void report(Parser* parser, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    
+    Diagnostics* diagnostics = parser->diagnostics;
+    if (diagnostics == NULL) {
+        vfprintf(stderr, format, args);
+        va_end(args);
+        return;
+    }
+    
+    va_list copy;
+    va_copy(copy, args);
+    int length = vsnprintf(NULL, 0, format, copy);
+    va_end(copy);
+    
+    if (length > 0) {
+        size_t needed = diagnostics->length + (size_t)length + 1;
+        if (needed > diagnostics->capacity) {
+            size_t capacity = diagnostics->capacity ? diagnostics->capacity : 256;
+            while (capacity < needed) capacity *= 2;
+            diagnostics->text = (char*)realloc(diagnostics->text, capacity);
+            diagnostics->capacity = capacity;
+        }
+        vsnprintf(diagnostics->text + diagnostics->length, (size_t)length + 1,
+                  format, args);
+        diagnostics->length += (size_t)length;
+    }
+    
+    va_end(args);
+}
+
+COLD static void error_at(Parser* parser, Token* token, const char* message) {
     if (parser->panic_mode) return;
     parser->panic_mode = 1;
     parser->had_error = 1;
+    parser->error_count++;
+    if (parser->diagnostics != NULL) parser->diagnostics->count++;
     
-    fprintf(stderr, "[Linea %d, Columna %d] Error", token->line, token->column);
+    report(parser, "[Linea %d, Columna %d] Error", token->line, token->column);
     
     if (token->type == TOKEN_EOF) {
-        fprintf(stderr, " al final del archivo");
+        report(parser, " al final del archivo");
     } else if (token->type == TOKEN_ERROR) {
-        // El mensaje ya está en el lexema
+        // El mensaje del lexer ya describe el error
     } else {
-        fprintf(stderr, " en '%s'", token->lexeme);
+        report(parser, " en '%.*s'", token->length, token->start);
     }
     
-    fprintf(stderr, ": %s\n", message);
+    report(parser, ": %s\n", message);
 }
 static void error_at_current(Parser* parser, const char* message) {
     error_at(parser, &parser->current, message);
 }
 
+// Los tokens del parser no se copian (modo descarte del lexer): el parser
+// solo necesita el tipo y la posición, y los mensajes de error toman el
+// texto del fuente (start/length). Así no hay reservas por token.
 static void advance(Parser* parser) {
-    token_free(&parser->previous);
+    parser->tokens++;
     parser->previous = parser->current;
     
+    // Pasado el EOF el lexer solo repetiría el mismo token (y --stats lo
+    // contaría dos veces); start es NULL antes del primer token
+    if (parser->current.type == TOKEN_EOF && parser->current.start != NULL) return;
+    
     for (;;) {
-        parser->current = lexer_next_token(parser->lexer);
+        parser->current = lexer_skip_token(parser->lexer);
         
-        if (parser->current.type != TOKEN_ERROR) break;
+        if (LIKELY(parser->current.type != TOKEN_ERROR)) break;
         
-        error_at_current(parser, parser->current.lexeme);
+        error_at_current(parser, parser->lexer->error_message);
     }
 }
 
@@ -58,33 +114,163 @@ static void consume(Parser* parser, TokenType type, const char* message) {
     error_at_current(parser, message);
 }
 
-// Sincronización para recuperación de errores
-static void synchronize(Parser* parser) {
-    parser->panic_mode = 0;
+// ==================== RECUPERACIÓN DE ERRORES ====================
+
+// Nivel en el que se retoma el análisis después de un error
+typedef enum {
+    SYNC_STATEMENT,     // Dentro de un bloque: siguiente sentencia
+    SYNC_DECL           // Nivel superior: siguiente declaración
+} SyncLevel;
+
+// Puntos de sincronización (de FOLLOW/FIRST en tabla_ll1.md):
+//   sentencia:   FOLLOW(bloque) = {end, else, loop, EOF}, FIRST(comando) =
+//                {if, while, return}, FIRST(statement) = {ID} al inicio de
+//                línea (FOLLOW(statement) = {NL}) y 'fun', que nunca aparece
+//                dentro de un bloque
+//   declaración: FIRST(decl) = {fun, ID} con ID al inicio de línea sin
+//                indentación (las sentencias del cuerpo van indentadas) y EOF
+static int is_sync_point(SyncLevel level, const Token* token, TokenType previous,
+                         int unindented) {
+    switch (token->type) {
+        case TOKEN_EOF:
+        case TOKEN_FUN:
+            return 1;
+        case TOKEN_END:
+        case TOKEN_ELSE:
+        case TOKEN_LOOP:
+        case TOKEN_IF:
+        case TOKEN_WHILE:
+        case TOKEN_RETURN:
+            return level == SYNC_STATEMENT;
+        case TOKEN_ID:
+            if (previous != TOKEN_NL) return 0;
+            return level == SYNC_STATEMENT || unindented;
+        default:
+            return 0;
+    }
+}
+
+// Verificar si el último token escaneado empieza en la columna 0 real
+// (Token.column no cuenta la indentación que consume el NL anterior)
+static int token_unindented(Parser* parser) {
+    const char* start = parser->lexer->start;
+    return start == parser->lexer->source || start[-1] == '\n';
+}
+
+// Saltar tokens hasta un punto de sincronización, que queda como token
+// actual. Los errores léxicos de lo saltado no se reportan.
+COLD static void skip_to_sync_point(Parser* parser, SyncLevel level) {
+    TokenType previous = parser->previous.type;
+    if (is_sync_point(level, &parser->current, previous, token_unindented(parser))) {
+        return;
+    }
+    
+    previous = parser->current.type;
     
-    while (parser->current.type != TOKEN_EOF) {
-        if (parser->previous.type == TOKEN_NL) return;
+    for (;;) {
+        Token token = lexer_skip_token(parser->lexer);
         
-        switch (parser->current.type) {
-            case TOKEN_FUN:
-            case TOKEN_IF:
-            case TOKEN_WHILE:
-            case TOKEN_RETURN:
-            case TOKEN_END:
-                return;
-            default:
-                ;
+        if (is_sync_point(level, &token, previous, token_unindented(parser))) {
+            parser->current = token;
+            break;
         }
         
-        advance(parser);
+        previous = token.type;
+    }
+    
+    parser->previous.type = previous;
+}
+
+// Con demasiados errores seguidos (entrada basura, archivo binario) se
+// salta directamente a la siguiente línea que empieza con 'fun' buscando
+// bytes, sin tokenizar lo que hay en medio
+COLD static void skip_to_function(Parser* parser) {
+    if (check(parser, TOKEN_FUN) || check(parser, TOKEN_EOF)) return;
+    
+    lexer_skip_to_line_with(parser->lexer, "fun");
+    
+    // Quedar como si el token anterior fuera el NL de la línea previa
+    parser->current.type = TOKEN_NL;
+    advance(parser);
+}
+
+// Sincronización para recuperación de errores. Cada token se salta a lo
+// sumo una vez, así que el costo total de recuperación es lineal.
+COLD static void synchronize(Parser* parser, SyncLevel level) {
+    STATS_RECOVERY(parser->lexer->stats);
+    
+    int errors = parser->error_count - parser->burst_start;
+    int lines = parser->current.line - parser->burst_line + 1;
+    
+    if (errors >= PARSER_ERROR_BURST && errors * PARSER_ERROR_DENSITY >= lines) {
+        skip_to_function(parser);
+        
+        // Los bloques abiertos se cierran en silencio hasta llegar al
+        // nivel de declaraciones
+        if (level == SYNC_STATEMENT) return;
+    } else {
+        skip_to_sync_point(parser, level);
+    }
+    
+    parser->panic_mode = 0;
+}
+
+// Entrar a un nivel de anidamiento dejando 'reserve' niveles libres
+// después de él; reporta error si se excede el limite
+static int enter_nesting(Parser* parser, int reserve) {
+    if (UNLIKELY(parser->depth + reserve >= parser->max_depth)) {
+        char message[96];
+        snprintf(message, sizeof(message),
+                 "Anidamiento demasiado profundo (maximo %d niveles)",
+                 parser->max_depth);
+        error_at_current(parser, message);
+        return 0;
+    }
+    
+    parser->depth++;
+    return 1;
+}
+
+static void leave_nesting(Parser* parser) {
+    parser->depth--;
+}
+
+// Saltar un bloque que excede el limite de anidamiento, con sus bloques
+// internos y las demás ramas de su if, hasta el 'end' o 'loop' que cierra
+// la sentencia (queda como token actual): el error ya se reportó una vez
+// y cada nivel más profundo lo repetiría. Los errores léxicos de lo
+// saltado no se reportan.
+COLD static void skip_nested_block(Parser* parser) {
+    TokenType previous = parser->previous.type;
+    int open = 0;
+    
+    for (;;) {
+        TokenType type = parser->current.type;
+        if (type == TOKEN_WHILE || (type == TOKEN_IF && previous != TOKEN_ELSE)) {
+            // 'else if' continúa el mismo if, no abre otro
+            open++;
+        } else if (type == TOKEN_END || type == TOKEN_LOOP) {
+            if (open == 0) break;
+            open--;
+        } else if (type == TOKEN_FUN || type == TOKEN_EOF) {
+            break;
+        }
+        
+        previous = type;
+        parser->current = lexer_skip_token(parser->lexer);
     }
+    
+    parser->previous.type = previous;
+    parser->panic_mode = 0;
 }
 
-// Verificar si estamos al final de un bloque
+// Verificar si estamos al final de un bloque ('fun' nunca va dentro de
+// un bloque: indica que falta cerrar la función anterior)
 static int is_block_end(Parser* parser) {
     return check(parser, TOKEN_END) ||
            check(parser, TOKEN_ELSE) ||
            check(parser, TOKEN_LOOP) ||
+           check(parser, TOKEN_FUN) ||
            check(parser, TOKEN_EOF);
 }
 
@@ -127,23 +313,39 @@ void parser_init(Parser* parser, Lexer* lexer) {
     parser->lexer = lexer;
     parser->had_error = 0;
     parser->panic_mode = 0;
+    parser->error_count = 0;
+    parser->burst_start = 0;
+    parser->burst_line = 1;
+    parser->depth = 0;
+    parser->max_depth = PARSER_MAX_DEPTH;
+    parser->diagnostics = NULL;
+    parser->profile = NULL;
+    parser->tokens = 0;
+    parser->previous.type = TOKEN_EOF;
     parser->previous.lexeme = NULL;
     parser->previous.string_value = NULL;
+    parser->previous.start = NULL;
+    parser->previous.length = 0;
+    parser->current.type = TOKEN_EOF;
     parser->current.lexeme = NULL;
     parser->current.string_value = NULL;
-    
-    advance(parser);
+    parser->current.start = NULL;
+    parser->current.length = 0;
 }
 
 int parser_parse(Parser* parser) {
+    // El primer token se lee aqui (no en parser_init) para que los errores
+    // lexicos iniciales ya vayan al destino de diagnosticos configurado
+    advance(parser);
     programa(parser);
     consume(parser, TOKEN_EOF, "Se esperaba fin de archivo");
+    if (parser->profile != NULL) profile_charge(parser->profile, parser->tokens);
     return !parser->had_error;
 }
 
 void parser_free(Parser* parser) {
-    token_free(&parser->previous);
-    token_free(&parser->current);
+    lexer_free_token(parser->lexer, &parser->previous);
+    lexer_free_token(parser->lexer, &parser->current);
 }
 
 // ===== TABLA LL1: No-terminal 'programa' =====
@@ -163,10 +365,19 @@ static void programa(Parser* parser) {
     }
     
     // LL1[programa, fun|ID] = decl programa
-    decl(parser);
-    
-    while (!check(parser, TOKEN_EOF) && !parser->had_error) {
+    while (!check(parser, TOKEN_EOF)) {
+        if (UNLIKELY(parser->panic_mode)) {
+            synchronize(parser, SYNC_DECL);
+            continue;
+        }
+        
+        // Una declaración sin errores cierra la racha de errores
+        int errors = parser->error_count;
         decl(parser);
+        if (parser->error_count == errors) {
+            parser->burst_start = errors;
+            parser->burst_line = parser->current.line;
+        }
     }
 }
 
@@ -174,8 +385,6 @@ static void programa(Parser* parser) {
 // LL1[decl, fun] = decl → funcion
 // LL1[decl, ID] = decl → global
 static void decl(Parser* parser) {
-    if (parser->panic_mode) synchronize(parser);
-    
     if (check(parser, TOKEN_FUN)) {
         // LL1[decl, fun] = decl → funcion
         funcion(parser);
@@ -201,6 +410,17 @@ static void global_decl(Parser* parser) {
 static void funcion(Parser* parser) {
     // LL1[funcion, fun] = 'fun' ID '(' params ')' [':' tipo] nl bloque 'end' nl
     consume(parser, TOKEN_FUN, "Se esperaba 'fun'");
+    
+    if (parser->profile != NULL) {
+        // Sin nombre valido el marco queda como "fun:linea"
+        Token name = parser->current;
+        if (name.type == TOKEN_ID) {
+            profile_enter(parser->profile, parser->tokens, name.start, name.length, name.line);
+        } else {
+            profile_enter(parser->profile, parser->tokens, "fun", 3, name.line);
+        }
+    }
+    
     consume(parser, TOKEN_ID, "Se esperaba nombre de funcion");
     consume(parser, TOKEN_LPAREN, "Se esperaba '(' despues del nombre de funcion");
     params(parser);
@@ -214,6 +434,8 @@ static void funcion(Parser* parser) {
     bloque(parser);
     consume(parser, TOKEN_END, "Se esperaba 'end' al final de la funcion");
     nl(parser);
+    
+    if (parser->profile != NULL) profile_leave(parser->profile, parser->tokens);
 }
 
 // ===== TABLA LL1: No-terminal 'bloque' (REFACTORIZADO) =====
@@ -223,7 +445,20 @@ static void funcion(Parser* parser) {
 // LL1[bloque, return] = bloque → comando nl bloque
 // LL1[bloque, end|else|loop] = bloque → ε
 static void bloque(Parser* parser) {
-    while (!is_block_end(parser) && !parser->had_error) {
+    // Un nivel queda libre para las expresiones de las sentencias: así el
+    // exceso se detecta al abrir el bloque y no en cada una de ellas
+    if (!enter_nesting(parser, 1)) {
+        skip_nested_block(parser);
+        return;
+    }
+    STATS_ENTER(parser->lexer->stats, block_depth, max_block_depth);
+    
+    while (!is_block_end(parser)) {
+        if (UNLIKELY(parser->panic_mode)) {
+            synchronize(parser, SYNC_STATEMENT);
+            continue;
+        }
+        
         if (check(parser, TOKEN_ID)) {
             // LL1[bloque, ID] = statement nl bloque
             statement(parser);
@@ -235,10 +470,13 @@ static void bloque(Parser* parser) {
             comando(parser);
             nl(parser);
         } else {
-            // LL1[bloque, end|else|loop] = ε
-            break;
+            // Token que no inicia sentencia ni cierra el bloque
+            error_at_current(parser, "Se esperaba una sentencia");
         }
     }
+    
+    STATS_LEAVE(parser->lexer->stats, block_depth);
+    leave_nesting(parser);
 }
 
 // ===== NUEVA FUNCIÓN LL1: No-terminal 'statement' =====
@@ -341,14 +579,15 @@ static void parametro(Parser* parser) {
 // LL1[tipo, [] = tipo → '[' ']' tipo
 // LL1[tipo, int|bool|char|string] = tipo → tipobase
 static void tipo(Parser* parser) {
-    if (match(parser, TOKEN_LBRACKET)) {
+    // La recursion de cola '[' ']' tipo se resuelve como ciclo, asi
+    // '[][][]...int' no consume pila
+    while (match(parser, TOKEN_LBRACKET)) {
         // LL1[tipo, [] = '[' ']' tipo
         consume(parser, TOKEN_RBRACKET, "Se esperaba ']' para tipo arreglo");
-        tipo(parser);
-    } else {
-        // LL1[tipo, int|bool|char|string] = tipobase
-        tipobase(parser);
     }
+    
+    // LL1[tipo, int|bool|char|string] = tipobase
+    tipobase(parser);
 }
 
 // ===== TABLA LL1: No-terminal 'tipobase' =====
@@ -402,6 +641,9 @@ static void comando(Parser* parser) {
 // LL1[cmdif, if] = cmdif → 'if' expression nl bloque { 'else' 'if' expression nl bloque } ['else' nl bloque] 'end'
 static void cmdif(Parser* parser) {
     // LL1[cmdif, if] = 'if' expression nl bloque ...
+    if (parser->profile != NULL) {
+        profile_enter(parser->profile, parser->tokens, "if", 2, parser->current.line);
+    }
     consume(parser, TOKEN_IF, "Se esperaba 'if'");
     expression(parser);
     nl(parser);
@@ -422,17 +664,24 @@ static void cmdif(Parser* parser) {
     }
     
     consume(parser, TOKEN_END, "Se esperaba 'end' al final del if");
+    
+    if (parser->profile != NULL) profile_leave(parser->profile, parser->tokens);
 }
 
 // ===== TABLA LL1: No-terminal 'cmdwhile' =====
 // LL1[cmdwhile, while] = cmdwhile → 'while' expression nl bloque 'loop'
 static void cmdwhile(Parser* parser) {
     // LL1[cmdwhile, while] = 'while' expression nl bloque 'loop'
+    if (parser->profile != NULL) {
+        profile_enter(parser->profile, parser->tokens, "while", 5, parser->current.line);
+    }
     consume(parser, TOKEN_WHILE, "Se esperaba 'while'");
     expression(parser);
     nl(parser);
     bloque(parser);
     consume(parser, TOKEN_LOOP, "Se esperaba 'loop' al final del while");
+    
+    if (parser->profile != NULL) profile_leave(parser->profile, parser->tokens);
 }
 
 // ===== TABLA LL1: No-terminal 'cmdreturn' =====
@@ -469,7 +718,11 @@ static void listaexp(Parser* parser) {
 // LL1[expression, FIRST(expr_or)] = expression → expr_or
 static void expression(Parser* parser) {
     // LL1[expression, ID|LITNUM|LITSTR|true|false|(|new|not|-] = expr_or
+    if (!enter_nesting(parser, 0)) return;
+    STATS_ENTER(parser->lexer->stats, expr_depth, max_expr_depth);
     expr_or(parser);
+    STATS_LEAVE(parser->lexer->stats, expr_depth);
+    leave_nesting(parser);
 }
 
 // ===== TABLA LL1: No-terminal 'expr_or' =====
@@ -538,13 +791,14 @@ static void expr_mul(Parser* parser) {
 // LL1[expr_unary, -] = expr_unary → '-' expr_unary
 // LL1[expr_unary, FIRST(expr_postfix)] = expr_unary → expr_postfix
 static void expr_unary(Parser* parser) {
-    if (match(parser, TOKEN_NOT) || match(parser, TOKEN_MINUS)) {
+    // La cadena de prefijos se consume en un ciclo (recursion de cola),
+    // asi 'not not not ...' no consume pila
+    while (match(parser, TOKEN_NOT) || match(parser, TOKEN_MINUS)) {
         // LL1[expr_unary, not|-] = ('not' | '-') expr_unary
-        expr_unary(parser);
-    } else {
-        // LL1[expr_unary, FIRST(expr_postfix)] = expr_postfix
-        expr_postfix(parser);
     }
+    
+    // LL1[expr_unary, FIRST(expr_postfix)] = expr_postfix
+    expr_postfix(parser);
 }
 
 // ===== TABLA LL1: No-terminal 'expr_postfix' =====
@@ -2,6 +2,39 @@
 #define PARSER_H
 
 #include "lexer.h"
+#include "profile.h"
+
+// Profundidad maxima de anidamiento de expresiones y bloques. Cada nivel
+// consume varios marcos de pila en el parser recursivo, asi que el limite
+// evita desbordar la pila con entradas generadas o adversarias.
+#ifndef PARSER_MAX_DEPTH
+#define PARSER_MAX_DEPTH 256
+#endif
+
+// Versión de lo que reporta el parser (mensajes, posiciones, recuperación).
+// Se guarda en el cache para no reproducir diagnósticos de un checker
+// anterior: subirla en el mismo cambio que modifique la salida.
+#define PARSER_DIAGNOSTICS_VERSION 3
+
+// Densidad de errores a partir de la cual la recuperación salta
+// directamente a la siguiente 'fun': al menos PARSER_ERROR_BURST errores
+// sin una declaración correcta entre ellos, con un promedio de un error
+// cada PARSER_ERROR_DENSITY líneas o menos
+#ifndef PARSER_ERROR_BURST
+#define PARSER_ERROR_BURST 8
+#endif
+#ifndef PARSER_ERROR_DENSITY
+#define PARSER_ERROR_DENSITY 4
+#endif
+
+// Buffer de diagnosticos. Si el parser tiene uno asignado, los mensajes
+// de error se acumulan aqui (mismo texto) en lugar de escribirse en stderr.
+typedef struct {
+    char* text;
+    size_t length;
+    size_t capacity;
+    int count;          // Numero de errores reportados
+} Diagnostics;
 
 typedef struct {
     Lexer* lexer;
@@ -9,9 +42,26 @@ typedef struct {
     Token previous;
     int had_error;
     int panic_mode;
+    
+    // Recuperación de errores
+    int error_count;    // Errores reportados
+    int burst_start;    // error_count al terminar la última declaración correcta
+    int burst_line;     // Línea en que terminó esa declaración
+    
+    // Control de anidamiento (expression y bloque)
+    int depth;
+    int max_depth;      // PARSER_MAX_DEPTH por defecto; ajustable tras init
+    
+    // Destino de los errores (NULL = stderr)
+    Diagnostics* diagnostics;
+    
+    // Perfil por construccion del fuente (NULL = sin perfil)
+    Profile* profile;
+    unsigned long tokens;   // Tokens consumidos (reloj de 'profile')
 } Parser;
 
-// Inicializar el parser
+// Inicializar el parser (los campos configurables, como max_depth y
+// diagnostics, pueden asignarse despues de esta llamada)
 void parser_init(Parser* parser, Lexer* lexer);
 
 // Parsear el programa completo
@@ -20,4 +70,8 @@ int parser_parse(Parser* parser);
 // Liberar recursos del parser
 void parser_free(Parser* parser);
 
+// Inicializar y liberar un buffer de diagnosticos
+void diagnostics_init(Diagnostics* diagnostics);
+void diagnostics_free(Diagnostics* diagnostics);
+
 #endif
\ No newline at end of file
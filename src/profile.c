@@ -0,0 +1,151 @@
+// profile.c
+#include "profile.h"
+#include <stdlib.h>
+#include <string.h>
+
+void profile_init(Profile* profile) {
+    memset(&profile->root, 0, sizeof(profile->root));
+    profile->current = &profile->root;
+    profile->clock = 0;
+    profile->lost = 0;
+    arena_init(&profile->arena);
+}
+
+void profile_free(Profile* profile) {
+    arena_free(&profile->arena);
+    profile_init(profile);
+}
+
+void profile_charge(Profile* profile, unsigned long clock) {
+    profile->current->samples += clock - profile->clock;
+    profile->clock = clock;
+}
+
+void profile_enter(Profile* profile, unsigned long clock,
+                   const char* name, int name_length, int line) {
+    profile_charge(profile, clock);
+    ProfileNode* parent = profile->current;
+    ProfileNode* node = (ProfileNode*)arena_alloc(&profile->arena, sizeof(ProfileNode));
+    if (node == NULL) {
+        // Sin memoria: las muestras siguen contando en el marco actual
+        profile->lost++;
+        return;
+    }
+    
+    memset(node, 0, sizeof(ProfileNode));
+    node->name = name;
+    node->name_length = name_length;
+    node->line = line;
+    node->parent = parent;
+    
+    if (parent->last_child == NULL) {
+        parent->child = node;
+    } else {
+        parent->last_child->sibling = node;
+    }
+    parent->last_child = node;
+    profile->current = node;
+}
+
+void profile_leave(Profile* profile, unsigned long clock) {
+    profile_charge(profile, clock);
+    if (profile->lost > 0) {
+        profile->lost--;
+    } else if (profile->current->parent != NULL) {
+        profile->current = profile->current->parent;
+    }
+}
+
+// Prefijo "programa;f:3;while:7" del marco que se esta escribiendo. Se
+// extiende al bajar a un hijo y se recorta al volver, asi cada linea es
+// un solo fwrite, en vez de recorrer la pila desde la raiz.
+typedef struct {
+    char* data;
+    size_t length;
+    size_t capacity;
+    int failed;
+} StackText;
+
+static void stack_append(StackText* text, const char* data, size_t length) {
+    if (text->length + length > text->capacity) {
+        size_t capacity = text->capacity == 0 ? 256 : text->capacity;
+        while (text->length + length > capacity) capacity *= 2;
+        char* grown = (char*)realloc(text->data, capacity);
+        if (grown == NULL) {
+            text->failed = 1;
+            return;
+        }
+        text->data = grown;
+        text->capacity = capacity;
+    }
+    memcpy(text->data + text->length, data, length);
+    text->length += length;
+}
+
+// Lineas ya formateadas; se escriben de a bloques y no de a una
+typedef struct {
+    char data[64 * 1024];
+    size_t length;
+} LineBuffer;
+
+static void lines_append(LineBuffer* lines, const char* data, size_t length, FILE* out) {
+    if (lines->length + length > sizeof(lines->data)) {
+        fwrite(lines->data, 1, lines->length, out);
+        lines->length = 0;
+        if (length > sizeof(lines->data)) {
+            fwrite(data, 1, length, out);
+            return;
+        }
+    }
+    memcpy(lines->data + lines->length, data, length);
+    lines->length += length;
+}
+
+// Agregar 'prefix' seguido de 'value' en decimal (sin printf: el perfil
+// de un fuente grande tiene cientos de miles de lineas)
+static void stack_append_number(StackText* text, char prefix, unsigned long value) {
+    char digits[24];
+    char* start = digits + sizeof(digits);
+    do {
+        *--start = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    *--start = prefix;
+    stack_append(text, start, (size_t)(digits + sizeof(digits) - start));
+}
+
+static void write_node(const ProfileNode* node, StackText* text, LineBuffer* lines, FILE* out) {
+    size_t mark = text->length;
+    if (node->parent == NULL) {
+        stack_append(text, "programa", 8);
+    } else {
+        stack_append(text, ";", 1);
+        stack_append(text, node->name, (size_t)node->name_length);
+        stack_append_number(text, ':', (unsigned long)node->line);
+    }
+    
+    if (node->samples > 0) {
+        size_t stack_end = text->length;
+        stack_append_number(text, ' ', node->samples);
+        stack_append(text, "\n", 1);
+        if (text->failed) return;
+        lines_append(lines, text->data, text->length, out);
+        text->length = stack_end;
+    }
+    if (text->failed) return;
+    
+    for (const ProfileNode* child = node->child; child != NULL; child = child->sibling) {
+        write_node(child, text, lines, out);
+    }
+    text->length = mark;
+}
+
+int profile_write_folded(const Profile* profile, FILE* out) {
+    StackText text = { NULL, 0, 0, 0 };
+    LineBuffer lines;
+    lines.length = 0;
+    write_node(&profile->root, &text, &lines, out);
+    fwrite(lines.data, 1, lines.length, out);
+    free(text.data);
+    return !text.failed && !ferror(out);
+}
@@ -0,0 +1,56 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdio.h>
+#include "arena.h"
+
+// Perfil del analisis por construccion del fuente (--profile).
+//
+// El parser mantiene una pila de marcos: la raiz "programa", cada funcion
+// ("nombre:linea") y cada if/while ("if:linea", "while:linea"). El reloj
+// es el numero de tokens consumidos, no el tiempo: cada token cuenta una
+// muestra del marco actual. El parser solo lleva un contador de tokens, y
+// la diferencia se carga al marco al entrar o salir de una construccion,
+// asi el costo es por marco y no por token. Es determinista, a diferencia
+// de un temporizador por señal, que a esta velocidad mediria sobre todo
+// ruido. La salida es el formato "folded" de flamegraph.pl / inferno:
+//   programa;main:3;while:7;if:9 123
+
+typedef struct ProfileNode {
+    const char* name;               // Nombre del marco (apunta al fuente)
+    int name_length;
+    int line;
+    unsigned long samples;          // Tokens consumidos en este marco
+    struct ProfileNode* parent;
+    struct ProfileNode* child;      // Primer hijo
+    struct ProfileNode* last_child; // Ultimo hijo (para agregar en orden)
+    struct ProfileNode* sibling;    // Siguiente hermano
+} ProfileNode;
+
+typedef struct {
+    ProfileNode root;
+    ProfileNode* current;
+    unsigned long clock;            // Tokens ya cargados a algun marco
+    Arena arena;                    // Marcos (se liberan todos juntos)
+    int lost;                       // Marcos sin memoria aun abiertos
+} Profile;
+
+void profile_init(Profile* profile);
+void profile_free(Profile* profile);
+
+// 'clock' es el numero de tokens consumidos hasta ahora. Cada llamada
+// carga al marco actual los tokens desde la llamada anterior.
+void profile_charge(Profile* profile, unsigned long clock);
+
+// Entrar al marco 'name:line'. 'name' no necesita terminar en '\0' y debe
+// seguir vivo hasta profile_write_folded (normalmente apunta al fuente).
+// Cada construccion se analiza una sola vez, asi que cada llamada crea
+// un marco nuevo.
+void profile_enter(Profile* profile, unsigned long clock,
+                   const char* name, int name_length, int line);
+void profile_leave(Profile* profile, unsigned long clock);
+
+// Escribir las pilas en formato folded. Retorna 0 si fallo la escritura.
+int profile_write_folded(const Profile* profile, FILE* out);
+
+#endif
@@ -0,0 +1,334 @@
+// push_parser.c
+#include "push_parser.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+// Pila del hilo del parser: la recursión llega a PARSER_MAX_DEPTH niveles
+#define PUSH_PARSER_STACK_SIZE (8 * 1024 * 1024)
+
+struct PushParser {
+    Lexer lexer;
+    Parser parser;
+    
+    // Datos cargados para el lexer, terminados en '\0'
+    char* buffer;
+    size_t length;
+    size_t capacity;
+    
+    // Datos entregados que el lexer aún no pidió; las líneas completas
+    // ocupan los primeros 'pending_lines' bytes
+    char* pending;
+    size_t pending_length;
+    size_t pending_lines;
+    size_t pending_capacity;
+    
+    // Estado compartido entre los dos hilos (protegido por 'mutex')
+    size_t want;        // Bytes nuevos que pidió el lexer
+    int waiting;        // El parser espera datos en refill
+    int resume;         // Reanudar el parser
+    int loaded;         // Respuesta de refill: 1 si se cargaron datos
+    int done;           // El parser terminó
+    int finished;       // Se llamó a push_parser_finish
+    int started;
+    int failed;         // Sin memoria o sin hilo
+    int success;
+
+#ifdef _WIN32
+    CRITICAL_SECTION mutex;
+    CONDITION_VARIABLE cond;
+    HANDLE thread;
+#else
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    pthread_t thread;
+#endif
+};
+
+// ==================== SINCRONIZACIÓN ====================
+
+#ifdef _WIN32
+
+static void sync_init(PushParser* push) {
+    InitializeCriticalSection(&push->mutex);
+    InitializeConditionVariable(&push->cond);
+}
+
+static void sync_destroy(PushParser* push) {
+    DeleteCriticalSection(&push->mutex);
+}
+
+static void push_lock(PushParser* push) { EnterCriticalSection(&push->mutex); }
+static void push_unlock(PushParser* push) { LeaveCriticalSection(&push->mutex); }
+static void push_wait(PushParser* push) { SleepConditionVariableCS(&push->cond, &push->mutex, INFINITE); }
+static void push_wake(PushParser* push) { WakeAllConditionVariable(&push->cond); }
+
+#else
+
+static void sync_init(PushParser* push) {
+    pthread_mutex_init(&push->mutex, NULL);
+    pthread_cond_init(&push->cond, NULL);
+}
+
+static void sync_destroy(PushParser* push) {
+    pthread_cond_destroy(&push->cond);
+    pthread_mutex_destroy(&push->mutex);
+}
+
+static void push_lock(PushParser* push) { pthread_mutex_lock(&push->mutex); }
+static void push_unlock(PushParser* push) { pthread_mutex_unlock(&push->mutex); }
+static void push_wait(PushParser* push) { pthread_cond_wait(&push->cond, &push->mutex); }
+static void push_wake(PushParser* push) { pthread_cond_broadcast(&push->cond); }
+
+#endif
+
+// ==================== HILO DEL PARSER ====================
+
+// LexerRefill: suspender el parser hasta que el otro hilo cargue datos
+static int push_refill(Lexer* lexer, size_t want) {
+    PushParser* push = (PushParser*)lexer->refill_data;
+    
+    push_lock(push);
+    push->want = want;
+    push->waiting = 1;
+    push_wake(push);
+    while (!push->resume) push_wait(push);
+    push->resume = 0;
+    push->waiting = 0;
+    int loaded = push->loaded;
+    push_unlock(push);
+    
+    return loaded;
+}
+
+static void run_parser(PushParser* push) {
+    int success = parser_parse(&push->parser);
+    
+    push_lock(push);
+    push->success = success;
+    push->done = 1;
+    push_wake(push);
+    push_unlock(push);
+}
+
+#ifdef _WIN32
+
+static DWORD WINAPI parser_thread(void* argument) {
+    run_parser((PushParser*)argument);
+    return 0;
+}
+
+static int start_thread(PushParser* push) {
+    push->thread = CreateThread(NULL, PUSH_PARSER_STACK_SIZE, parser_thread, push,
+                                STACK_SIZE_PARAM_IS_A_RESERVATION, NULL);
+    return push->thread != NULL;
+}
+
+static void join_thread(PushParser* push) {
+    WaitForSingleObject(push->thread, INFINITE);
+    CloseHandle(push->thread);
+}
+
+#else
+
+static void* parser_thread(void* argument) {
+    run_parser((PushParser*)argument);
+    return NULL;
+}
+
+static int start_thread(PushParser* push) {
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, PUSH_PARSER_STACK_SIZE);
+    int ok = pthread_create(&push->thread, &attr, parser_thread, push) == 0;
+    pthread_attr_destroy(&attr);
+    return ok;
+}
+
+static void join_thread(PushParser* push) {
+    pthread_join(push->thread, NULL);
+}
+
+#endif
+
+// ==================== DATOS ====================
+
+// Pasar 'count' bytes de 'pending' al buffer del lexer, descartando lo que
+// hay antes de lexer->current - 1. Solo se llama con el parser suspendido.
+static int load(PushParser* push, size_t count) {
+    Lexer* lexer = &push->lexer;
+    
+    size_t position = (size_t)(lexer->current - push->buffer);
+    size_t keep_from = position > 0 ? position - 1 : 0;
+    size_t kept = push->length - keep_from;
+    size_t needed = kept + count + 1 + SIMD_PAD;
+    
+    if (needed > push->capacity) {
+        size_t capacity = push->capacity * 2;
+        if (capacity < needed) capacity = needed;
+        char* buffer = (char*)realloc(push->buffer, capacity);
+        if (buffer == NULL) return 0;
+        push->buffer = buffer;
+        push->capacity = capacity;
+    }
+    
+    memmove(push->buffer, push->buffer + keep_from, kept);
+    memcpy(push->buffer + kept, push->pending, count);
+    push->length = kept + count;
+    memset(push->buffer + push->length, 0, 1 + SIMD_PAD);
+    
+    push->pending_length -= count;
+    push->pending_lines -= count < push->pending_lines ? count : push->pending_lines;
+    memmove(push->pending, push->pending + count, push->pending_length);
+    
+    lexer->source = push->buffer;
+    lexer->current = push->buffer + (position - keep_from);
+    lexer->start = lexer->current;
+    lexer->end = push->buffer + push->length;
+    return 1;
+}
+
+// Esperar a que el parser pida datos o termine
+static void wait_parser(PushParser* push) {
+    while (!push->waiting && !push->done) push_wait(push);
+}
+
+// Reanudar el parser suspendido y esperar a que se vuelva a suspender
+static void resume_parser(PushParser* push, int loaded) {
+    push->loaded = loaded;
+    push->resume = 1;
+    push_wake(push);
+    
+    // El parser debe salir de refill antes de que se vuelva a mirar
+    // 'waiting'
+    while (push->resume) push_wait(push);
+    wait_parser(push);
+}
+
+static int ensure_started(PushParser* push) {
+    if (push->started) return 1;
+    if (push->failed) return 0;
+    
+    if (!start_thread(push)) {
+        push->failed = 1;
+        return 0;
+    }
+    push->started = 1;
+    return 1;
+}
+
+PushParser* push_parser_new(Diagnostics* diagnostics) {
+    PushParser* push = (PushParser*)calloc(1, sizeof(PushParser));
+    if (push == NULL) return NULL;
+    
+    push->capacity = 64 * 1024;
+    push->buffer = (char*)malloc(push->capacity);
+    if (push->buffer == NULL) {
+        free(push);
+        return NULL;
+    }
+    memset(push->buffer, 0, 1 + SIMD_PAD);
+    
+    lexer_init(&push->lexer, push->buffer);
+    push->lexer.padded = 1;
+    push->lexer.end = push->buffer;
+    push->lexer.refill = push_refill;
+    push->lexer.refill_data = push;
+    
+    parser_init(&push->parser, &push->lexer);
+    push->parser.diagnostics = diagnostics;
+    
+    sync_init(push);
+    return push;
+}
+
+int push_parser_feed(PushParser* push, const char* data, size_t length) {
+    if (push->failed) return 0;
+    if (push->done || length == 0) return 1;
+    
+    // Agregar a los datos pendientes
+    size_t needed = push->pending_length + length;
+    if (needed > push->pending_capacity) {
+        size_t capacity = push->pending_capacity * 2;
+        if (capacity < needed) capacity = needed;
+        char* pending = (char*)realloc(push->pending, capacity);
+        if (pending == NULL) {
+            push->failed = 1;
+            return 0;
+        }
+        push->pending = pending;
+        push->pending_capacity = capacity;
+    }
+    memcpy(push->pending + push->pending_length, data, length);
+    push->pending_length += length;
+    
+    for (size_t i = push->pending_length; i > push->pending_length - length; i--) {
+        if (push->pending[i - 1] == '\n') {
+            push->pending_lines = i;
+            break;
+        }
+    }
+    
+    if (!ensure_started(push)) return 0;
+    
+    push_lock(push);
+    wait_parser(push);
+    if (!push->done && push->pending_lines >= push->want) {
+        if (!load(push, push->pending_lines)) {
+            push->failed = 1;
+        } else {
+            resume_parser(push, 1);
+        }
+    }
+    push_unlock(push);
+    
+    return !push->failed;
+}
+
+int push_parser_finish(PushParser* push) {
+    if (push->finished) return !push->failed && push->success;
+    push->finished = 1;
+    
+    if (!ensure_started(push)) return 0;
+    
+    push_lock(push);
+    wait_parser(push);
+    while (!push->done) {
+        // Todo lo pendiente, incluida la última línea sin '\n'. Tras un
+        // fallo el parser termina como si el fuente acabara ahí.
+        int loaded = 0;
+        if (!push->failed && push->pending_length > 0) {
+            loaded = load(push, push->pending_length);
+            if (!loaded) push->failed = 1;
+        }
+        resume_parser(push, loaded);
+    }
+    push_unlock(push);
+    
+    join_thread(push);
+    push->started = 0;
+    
+    return !push->failed && push->success;
+}
+
+int push_parser_error_count(const PushParser* push) {
+    return push->parser.error_count;
+}
+
+void push_parser_free(PushParser* push) {
+    if (push == NULL) return;
+    
+    // Un análisis sin terminar se termina antes de liberar
+    if (push->started) push_parser_finish(push);
+    
+    parser_free(&push->parser);
+    sync_destroy(push);
+    free(push->pending);
+    free(push->buffer);
+    free(push);
+}
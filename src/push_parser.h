@@ -0,0 +1,37 @@
+#ifndef PUSH_PARSER_H
+#define PUSH_PARSER_H
+
+#include <stddef.h>
+#include "parser.h"
+
+// Análisis por partes: el fuente se entrega con push_parser_feed a medida
+// que llega (por ejemplo desde una tubería) y push_parser_finish termina
+// el análisis. Los diagnósticos son los mismos que al analizar el fuente
+// completo.
+//
+// El parser recursivo corre en su propio hilo y se suspende cuando el
+// lexer llega al final de los datos cargados (ver LexerRefill en lexer.h);
+// push_parser_feed lo reanuda y espera a que vuelva a pedir datos, así que
+// nunca corren los dos hilos a la vez. Solo se conservan las líneas desde
+// el token en curso: la memoria depende del tamaño de las partes y del
+// token más largo, no del tamaño del fuente.
+
+typedef struct PushParser PushParser;
+
+// Crear un analizador. Los errores van a 'diagnostics' (NULL = stderr).
+// Retorna NULL si no hay memoria.
+PushParser* push_parser_new(Diagnostics* diagnostics);
+
+// Entregar los siguientes 'length' bytes del fuente. Retorna 0 si no hay
+// memoria o no se pudo crear el hilo del parser.
+int push_parser_feed(PushParser* push, const char* data, size_t length);
+
+// Fin del fuente: termina el análisis. Retorna 1 si es correcto.
+int push_parser_finish(PushParser* push);
+
+// Número de errores reportados (válido tras push_parser_finish)
+int push_parser_error_count(const PushParser* push);
+
+void push_parser_free(PushParser* push);
+
+#endif
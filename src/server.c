@@ -0,0 +1,386 @@
+// server.c
+#include "server.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+
+int server_run(const char* socket_path) {
+    (void)socket_path;
+    fprintf(stderr, "Error: El modo servidor requiere sockets Unix\n");
+    return 1;
+}
+
+int client_run(const char* socket_path, const char* path) {
+    (void)socket_path;
+    (void)path;
+    fprintf(stderr, "Error: El modo cliente requiere sockets Unix\n");
+    return 1;
+}
+
+#else
+
+#include "lexer.h"
+#include "parser.h"
+#include "cache.h"
+#include "source.h"
+#include <errno.h>
+#include <limits.h>
+#include <signal.h>
+#include <stdint.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Resultado guardado de un archivo
+typedef struct Entry {
+    char* path;
+    time_t mtime;
+    long mtime_nsec;
+    off_t size;
+    uint64_t hash;
+    int success;
+    char* diagnostics;
+    size_t diagnostics_length;
+    struct Entry* next;         // Siguiente en la misma cubeta
+} Entry;
+
+typedef struct {
+    Entry** buckets;
+    size_t bucket_count;
+    size_t count;
+} EntryTable;
+
+static volatile sig_atomic_t stop_requested = 0;
+
+static void on_signal(int signal_number) {
+    (void)signal_number;
+    stop_requested = 1;
+}
+
+// ==================== TABLA DE RESULTADOS ====================
+
+// Retorna 0 si no hay memoria
+static int table_init(EntryTable* table) {
+    table->bucket_count = 1024;
+    table->buckets = (Entry**)calloc(table->bucket_count, sizeof(Entry*));
+    table->count = 0;
+    return table->buckets != NULL;
+}
+
+static void table_free(EntryTable* table) {
+    for (size_t i = 0; i < table->bucket_count; i++) {
+        Entry* entry = table->buckets[i];
+        while (entry != NULL) {
+            Entry* next = entry->next;
+            free(entry->path);
+            free(entry->diagnostics);
+            free(entry);
+            entry = next;
+        }
+    }
+    free(table->buckets);
+}
+
+// Sin memoria la tabla conserva sus cubetas: las cadenas quedan mas
+// largas, pero las entradas siguen siendo validas
+static void table_grow(EntryTable* table) {
+    size_t bucket_count = table->bucket_count * 2;
+    Entry** buckets = (Entry**)calloc(bucket_count, sizeof(Entry*));
+    if (buckets == NULL) return;
+    
+    for (size_t i = 0; i < table->bucket_count; i++) {
+        Entry* entry = table->buckets[i];
+        while (entry != NULL) {
+            Entry* next = entry->next;
+            size_t index = cache_hash(entry->path, strlen(entry->path)) & (bucket_count - 1);
+            entry->next = buckets[index];
+            buckets[index] = entry;
+            entry = next;
+        }
+    }
+    
+    free(table->buckets);
+    table->buckets = buckets;
+    table->bucket_count = bucket_count;
+}
+
+// Buscar la entrada de 'path'; la crea vacia si no existe. Retorna NULL
+// si no hay memoria para crearla.
+static Entry* table_get(EntryTable* table, const char* path) {
+    size_t index = cache_hash(path, strlen(path)) & (table->bucket_count - 1);
+    
+    for (Entry* entry = table->buckets[index]; entry != NULL; entry = entry->next) {
+        if (strcmp(entry->path, path) == 0) return entry;
+    }
+    
+    if (table->count + 1 > table->bucket_count) {
+        table_grow(table);
+        index = cache_hash(path, strlen(path)) & (table->bucket_count - 1);
+    }
+    
+    Entry* entry = (Entry*)calloc(1, sizeof(Entry));
+    if (entry == NULL) return NULL;
+    entry->path = strdup(path);
+    if (entry->path == NULL) {
+        free(entry);
+        return NULL;
+    }
+    entry->size = -1;
+    entry->next = table->buckets[index];
+    table->buckets[index] = entry;
+    table->count++;
+    return entry;
+}
+
+// ==================== ANALISIS ====================
+
+static void analyze(Entry* entry, const char* source, size_t length, uint64_t hash) {
+    Lexer lexer;
+    lexer_init(&lexer, source);
+    lexer.padded = 1;
+    lexer.end = source + length;
+    
+    Parser parser;
+    parser_init(&parser, &lexer);
+    
+    Diagnostics diagnostics;
+    diagnostics_init(&diagnostics);
+    parser.diagnostics = &diagnostics;
+    
+    entry->success = parser_parse(&parser);
+    parser_free(&parser);
+    
+    free(entry->diagnostics);
+    entry->diagnostics = diagnostics.text;
+    entry->diagnostics_length = diagnostics.length;
+    entry->hash = hash;
+}
+
+// Actualizar la entrada si el archivo cambio. Retorna 0 si no se pudo leer.
+static int refresh(Entry* entry, const char* path) {
+    struct stat st;
+    if (stat(path, &st) != 0) return 0;
+    
+    if (entry->size == st.st_size && entry->mtime == st.st_mtime &&
+        entry->mtime_nsec == (long)st.st_mtim.tv_nsec) {
+        return 1;
+    }
+    
+    size_t length = 0;
+    char* source = read_file(path, &length);
+    if (source == NULL) return 0;
+    
+    // Un mtime nuevo con el mismo contenido no requiere reanalizar
+    uint64_t hash = cache_hash(source, length);
+    if (entry->size < 0 || entry->hash != hash) {
+        analyze(entry, source, length, hash);
+    }
+    
+    entry->size = st.st_size;
+    entry->mtime = st.st_mtime;
+    entry->mtime_nsec = (long)st.st_mtim.tv_nsec;
+    free(source);
+    return 1;
+}
+
+// ==================== SOCKETS ====================
+
+static int write_all(int fd, const char* data, size_t length) {
+    while (length > 0) {
+        ssize_t n = write(fd, data, length);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return 0;
+        }
+        data += n;
+        length -= (size_t)n;
+    }
+    return 1;
+}
+
+// Leer una linea terminada en '\n' (sin incluirlo)
+static int read_line(int fd, char* line, size_t size) {
+    size_t length = 0;
+    
+    while (length + 1 < size) {
+        char c;
+        ssize_t n = read(fd, &c, 1);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return 0;
+        if (c == '\n') {
+            line[length] = '\0';
+            return 1;
+        }
+        line[length++] = c;
+    }
+    
+    return 0;
+}
+
+static int make_address(struct sockaddr_un* address, const char* socket_path) {
+    if (strlen(socket_path) >= sizeof(address->sun_path)) {
+        fprintf(stderr, "Error: Ruta de socket demasiado larga '%s'\n", socket_path);
+        return 0;
+    }
+    
+    memset(address, 0, sizeof(*address));
+    address->sun_family = AF_UNIX;
+    strcpy(address->sun_path, socket_path);
+    return 1;
+}
+
+// Preparar la ruta del socket: solo se borra un socket abandonado, nunca
+// un archivo comun ni el socket de un servidor que sigue respondiendo
+static int claim_socket_path(const struct sockaddr_un* address, const char* socket_path) {
+    struct stat st;
+    if (lstat(socket_path, &st) != 0) return errno == ENOENT;
+    if (!S_ISSOCK(st.st_mode)) return 0;
+    
+    int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (probe < 0) return 0;
+    int alive = connect(probe, (const struct sockaddr*)address, sizeof(*address)) == 0;
+    close(probe);
+    if (alive) {
+        fprintf(stderr, "Error: Ya hay un servidor escuchando en '%s'\n", socket_path);
+        return 0;
+    }
+    
+    return unlink(socket_path) == 0;
+}
+
+static void set_client_timeout(int client) {
+    struct timeval timeout;
+    timeout.tv_sec = SERVER_CLIENT_TIMEOUT;
+    timeout.tv_usec = 0;
+    setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+}
+
+// Responder un fallo con el mismo formato que los diagnosticos
+static void send_error(int client, const char* message, const char* path) {
+    char text[PATH_MAX + 128];
+    int length = snprintf(text, sizeof(text), "0\nError: %s '%s'\n", message, path);
+    write_all(client, text, (size_t)length);
+}
+
+static void serve_client(EntryTable* table, int client) {
+    char path[PATH_MAX + 1];
+    if (!read_line(client, path, sizeof(path))) return;
+    
+    Entry* entry = table_get(table, path);
+    if (entry == NULL) {
+        send_error(client, "No hay memoria suficiente para analizar", path);
+        return;
+    }
+    if (!refresh(entry, path)) {
+        send_error(client, "No se pudo abrir el archivo", path);
+        entry->size = -1;
+        return;
+    }
+    
+    write_all(client, entry->success ? "1\n" : "0\n", 2);
+    write_all(client, entry->diagnostics, entry->diagnostics_length);
+}
+
+int server_run(const char* socket_path) {
+    struct sockaddr_un address;
+    if (!make_address(&address, socket_path)) return 1;
+    
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        perror("socket");
+        return 1;
+    }
+    
+    if (!claim_socket_path(&address, socket_path) ||
+        bind(listener, (struct sockaddr*)&address, sizeof(address)) != 0 ||
+        listen(listener, 64) != 0) {
+        fprintf(stderr, "Error: No se pudo escuchar en '%s'\n", socket_path);
+        close(listener);
+        return 1;
+    }
+    
+    // Sin SA_RESTART: accept() se interrumpe al recibir la senal
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = on_signal;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    signal(SIGPIPE, SIG_IGN);
+    
+    EntryTable table;
+    if (!table_init(&table)) {
+        fprintf(stderr, "Error: No hay memoria suficiente para el servidor\n");
+        close(listener);
+        unlink(socket_path);
+        return 1;
+    }
+    
+    while (!stop_requested) {
+        int client = accept(listener, NULL, NULL);
+        if (client < 0) {
+            if (errno == EINTR) continue;
+            perror("accept");
+            break;
+        }
+        
+        set_client_timeout(client);
+        serve_client(&table, client);
+        close(client);
+    }
+    
+    table_free(&table);
+    close(listener);
+    unlink(socket_path);
+    return 0;
+}
+
+int client_run(const char* socket_path, const char* path) {
+    // El servidor tiene otro directorio de trabajo: enviar ruta absoluta
+    char absolute[PATH_MAX];
+    if (realpath(path, absolute) == NULL) {
+        fprintf(stderr, "Error: No se pudo abrir el archivo '%s'\n", path);
+        return 1;
+    }
+    
+    struct sockaddr_un address;
+    if (!make_address(&address, socket_path)) return 1;
+    
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr*)&address, sizeof(address)) != 0) {
+        fprintf(stderr, "Error: No se pudo conectar al servidor '%s'\n", socket_path);
+        if (fd >= 0) close(fd);
+        return 1;
+    }
+    
+    size_t length = strlen(absolute);
+    absolute[length] = '\n';
+    if (!write_all(fd, absolute, length + 1)) {
+        fprintf(stderr, "Error: No se pudo enviar la peticion al servidor\n");
+        close(fd);
+        return 1;
+    }
+    
+    char status[4];
+    if (!read_line(fd, status, sizeof(status))) {
+        fprintf(stderr, "Error: Respuesta invalida del servidor\n");
+        close(fd);
+        return 1;
+    }
+    
+    // El resto de la respuesta son los diagnosticos
+    char buffer[4096];
+    ssize_t n;
+    while ((n = read(fd, buffer, sizeof(buffer))) > 0 || (n < 0 && errno == EINTR)) {
+        if (n > 0) fwrite(buffer, 1, (size_t)n, stderr);
+    }
+    
+    close(fd);
+    return status[0] == '1' ? 0 : 1;
+}
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+// Modo servidor: un proceso residente escucha en un socket Unix y analiza
+// los archivos que le piden los clientes, guardando en memoria el
+// resultado de cada archivo. Una entrada se reutiliza mientras el mtime
+// y el tamaño no cambien; si cambian, se relee el archivo y solo se
+// vuelve a analizar si cambio el hash del contenido.
+//
+// Protocolo (una peticion por conexion):
+//   cliente -> servidor:  "<ruta absoluta>\n"
+//   servidor -> cliente:  "<exito 0|1>\n" seguido del texto de diagnosticos
+//
+// Los clientes se atienden de a uno; un cliente que no envia la ruta (o
+// no lee la respuesta) en SERVER_CLIENT_TIMEOUT segundos se desconecta
+// para no bloquear a los siguientes.
+
+#define SERVER_CLIENT_TIMEOUT 5
+
+// Ejecutar el servidor hasta recibir SIGINT/SIGTERM. Solo reemplaza un
+// socket abandonado: si la ruta existe y no es un socket, o si otro
+// servidor responde en ella, no se inicia. Retorna el codigo de salida
+// del proceso.
+int server_run(const char* socket_path);
+
+// Cliente ligero: reenvia 'path' al servidor, escribe los diagnosticos en
+// stderr y retorna el mismo codigo de salida que un analisis local.
+int client_run(const char* socket_path, const char* path);
+
+#endif
@@ -0,0 +1,44 @@
+// source.c
+#include "source.h"
+#include "lexer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Leer archivo completo a un string (tamaño en 'size')
+char* read_file(const char* path, size_t* size) {
+    FILE* file = fopen(path, "rb");
+    
+    if (file == NULL) {
+        fprintf(stderr, "Error: No se pudo abrir el archivo '%s'\n", path);
+        return NULL;
+    }
+    
+    // Obtener tamaño del archivo
+    fseek(file, 0L, SEEK_END);
+    size_t file_size = ftell(file);
+    rewind(file);
+    
+    // Reservar memoria (con SIMD_PAD bytes después del '\0' para el lexer)
+    char* buffer = (char*)malloc(file_size + 1 + SIMD_PAD);
+    if (buffer == NULL) {
+        fprintf(stderr, "Error: No hay memoria suficiente para leer '%s'\n", path);
+        fclose(file);
+        return NULL;
+    }
+    
+    // Leer archivo
+    size_t bytes_read = fread(buffer, sizeof(char), file_size, file);
+    if (bytes_read < file_size) {
+        fprintf(stderr, "Error: No se pudo leer el archivo '%s'\n", path);
+        free(buffer);
+        fclose(file);
+        return NULL;
+    }
+    
+    memset(buffer + bytes_read, 0, 1 + SIMD_PAD);
+    fclose(file);
+    *size = bytes_read;
+    
+    return buffer;
+}
@@ -0,0 +1,11 @@
+#ifndef SOURCE_H
+#define SOURCE_H
+
+#include <stddef.h>
+
+// Leer archivo completo a un string terminado en '\0', seguido de SIMD_PAD
+// bytes reservados (el lexer puede usarlo con lexer->padded = 1). Retorna
+// NULL (y reporta en stderr) si no se pudo leer; el tamaño queda en 'size'.
+char* read_file(const char* path, size_t* size);
+
+#endif
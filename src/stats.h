@@ -0,0 +1,55 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include "tokens.h"
+#include <stddef.h>
+
+// Contadores de rendimiento para --stats.
+// Solo se actualizan si se compila con -DMINI0_STATS; en otro caso las
+// macros se expanden a nada y el lexer/parser no pagan ningun costo.
+typedef struct {
+    unsigned long tokens[TOKEN_ERROR + 1];  // Tokens producidos por tipo
+    unsigned long allocations;              // Reservas de make_token/scan_string
+    size_t bytes_allocated;                 // Bytes de esas reservas
+    int expr_depth;                         // Profundidad actual de expression
+    int max_expr_depth;                     // Profundidad maxima de expression
+    int block_depth;                        // Profundidad actual de bloque
+    int max_block_depth;                    // Profundidad maxima de bloque
+    unsigned long recoveries;               // Llamadas a synchronize
+} Stats;
+
+#ifdef MINI0_STATS
+
+#define STATS_TOKEN(s, type) \
+    do { if ((s) != NULL) (s)->tokens[(type)]++; } while (0)
+
+#define STATS_BYTES(s, n) \
+    do { \
+        if ((s) != NULL) { \
+            (s)->allocations++; \
+            (s)->bytes_allocated += (size_t)(n); \
+        } \
+    } while (0)
+
+#define STATS_ENTER(s, cur, max) \
+    do { \
+        if ((s) != NULL && ++(s)->cur > (s)->max) (s)->max = (s)->cur; \
+    } while (0)
+
+#define STATS_LEAVE(s, cur) \
+    do { if ((s) != NULL) (s)->cur--; } while (0)
+
+#define STATS_RECOVERY(s) \
+    do { if ((s) != NULL) (s)->recoveries++; } while (0)
+
+#else
+
+#define STATS_TOKEN(s, type)      ((void)0)
+#define STATS_BYTES(s, n)         ((void)0)
+#define STATS_ENTER(s, cur, max)  ((void)0)
+#define STATS_LEAVE(s, cur)       ((void)0)
+#define STATS_RECOVERY(s)         ((void)0)
+
+#endif
+
+#endif
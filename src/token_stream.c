@@ -0,0 +1,261 @@
+// token_stream.c
+#include "token_stream.h"
+#include "lexer.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TOKEN_STREAM_MAGIC "M0TS"
+
+// Tamaño del buffer de salida y espacio maximo que puede ocupar un
+// registro sin contar el texto del token (que se copia por partes)
+#define OUTPUT_BUFFER_SIZE (1 << 20)
+#define RECORD_RESERVE 256
+
+typedef struct {
+    char* data;
+    size_t length;
+    FILE* out;
+    int failed;
+} Output;
+
+static void output_flush(Output* output) {
+    if (output->length > 0 && !output->failed &&
+        fwrite(output->data, 1, output->length, output->out) != output->length) {
+        output->failed = 1;
+    }
+    output->length = 0;
+}
+
+// Asegurar espacio para 'extra' bytes (extra <= OUTPUT_BUFFER_SIZE)
+static char* output_reserve(Output* output, size_t extra) {
+    if (output->length + extra > OUTPUT_BUFFER_SIZE) {
+        output_flush(output);
+    }
+    return output->data + output->length;
+}
+
+static void output_append(Output* output, const char* data, size_t length) {
+    memcpy(output_reserve(output, length), data, length);
+    output->length += length;
+}
+
+static void put_u32(unsigned char* p, uint32_t value) {
+    for (int i = 0; i < 4; i++) p[i] = (unsigned char)(value >> (8 * i));
+}
+
+// ==================== FORMATO BINARIO ====================
+
+static void write_binary_header(Output* output) {
+    unsigned char header[TOKEN_STREAM_HEADER_SIZE];
+    memset(header, 0, sizeof(header));
+    memcpy(header, TOKEN_STREAM_MAGIC, 4);
+    put_u32(header + 4, TOKEN_STREAM_VERSION);
+    put_u32(header + 8, TOKEN_STREAM_RECORD_SIZE);
+    output_append(output, (const char*)header, sizeof(header));
+}
+
+static void write_binary_record(Output* output, const Token* token,
+                                size_t offset, size_t length) {
+    unsigned char* p = (unsigned char*)output_reserve(output, TOKEN_STREAM_RECORD_SIZE);
+    p[0] = (unsigned char)token->type;
+    p[1] = p[2] = p[3] = 0;
+    put_u32(p + 4, (uint32_t)offset);
+    put_u32(p + 8, (uint32_t)length);
+    put_u32(p + 12, (uint32_t)token->line);
+    put_u32(p + 16, (uint32_t)token->column);
+    put_u32(p + 20, (uint32_t)token->int_value);
+    output->length += TOKEN_STREAM_RECORD_SIZE;
+}
+
+// ==================== FORMATO JSON ====================
+
+// Escribir un entero decimal; retorna el puntero al final
+static char* put_decimal(char* p, long long value) {
+    char digits[24];
+    int count = 0;
+    unsigned long long magnitude = value < 0 ? 0ULL - (unsigned long long)value
+                                             : (unsigned long long)value;
+    
+    if (value < 0) *p++ = '-';
+    do {
+        digits[count++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+    
+    while (count > 0) *p++ = digits[--count];
+    return p;
+}
+
+static char* put_text(char* p, const char* text) {
+    size_t length = strlen(text);
+    memcpy(p, text, length);
+    return p + length;
+}
+
+// Largo de la secuencia UTF-8 válida que empieza en 'p' (0 si no lo es):
+// sin formas largas, sin sustitutos y hasta U+10FFFF
+static size_t utf8_sequence(const unsigned char* p, size_t available) {
+    unsigned char c = p[0];
+    size_t length;
+    unsigned char low = 0x80, high = 0xBF;   // Rango del segundo byte
+    
+    if (c >= 0xC2 && c <= 0xDF) {
+        length = 2;
+    } else if (c >= 0xE0 && c <= 0xEF) {
+        length = 3;
+        if (c == 0xE0) low = 0xA0;
+        if (c == 0xED) high = 0x9F;
+    } else if (c >= 0xF0 && c <= 0xF4) {
+        length = 4;
+        if (c == 0xF0) low = 0x90;
+        if (c == 0xF4) high = 0x8F;
+    } else {
+        return 0;
+    }
+    
+    if (available < length || p[1] < low || p[1] > high) return 0;
+    for (size_t i = 2; i < length; i++) {
+        if ((p[i] & 0xC0) != 0x80) return 0;
+    }
+    return length;
+}
+
+// Texto como string JSON (sin comillas). Los tramos sin caracteres que
+// escapar se copian de una vez. Las secuencias UTF-8 válidas se copian
+// tal cual; cualquier otro byte >= 0x80 (por ejemplo un fuente en
+// Latin-1) se escribe como \u00XX, así que la salida siempre es UTF-8.
+static void append_json_string(Output* output, const char* text, size_t length) {
+    static const char hex[] = "0123456789abcdef";
+    const unsigned char* bytes = (const unsigned char*)text;
+    size_t run = 0;
+    size_t i = 0;
+    
+    while (i < length) {
+        unsigned char c = bytes[i];
+        if (c >= 0x20 && c < 0x80 && c != '"' && c != '\\') {
+            i++;
+            continue;
+        }
+        if (c >= 0x80) {
+            size_t sequence = utf8_sequence(bytes + i, length - i);
+            if (sequence > 0) {
+                i += sequence;
+                continue;
+            }
+        }
+        
+        // Copiar el tramo pendiente (puede ser mayor que el buffer)
+        while (run < i) {
+            size_t chunk = i - run;
+            if (chunk > OUTPUT_BUFFER_SIZE / 2) chunk = OUTPUT_BUFFER_SIZE / 2;
+            output_append(output, text + run, chunk);
+            run += chunk;
+        }
+        
+        char* p = output_reserve(output, 6);
+        *p++ = '\\';
+        switch (c) {
+            case '"':  *p++ = '"';  break;
+            case '\\': *p++ = '\\'; break;
+            case '\n': *p++ = 'n';  break;
+            case '\r': *p++ = 'r';  break;
+            case '\t': *p++ = 't';  break;
+            default:
+                *p++ = 'u';
+                *p++ = '0';
+                *p++ = '0';
+                *p++ = hex[c >> 4];
+                *p++ = hex[c & 15];
+                break;
+        }
+        output->length = (size_t)(p - output->data);
+        i++;
+        run = i;
+    }
+    
+    while (run < length) {
+        size_t chunk = length - run;
+        if (chunk > OUTPUT_BUFFER_SIZE / 2) chunk = OUTPUT_BUFFER_SIZE / 2;
+        output_append(output, text + run, chunk);
+        run += chunk;
+    }
+}
+
+static void write_json_record(Output* output, const Token* token, const char* text,
+                              size_t offset, size_t length, const char* error) {
+    char* p = output_reserve(output, RECORD_RESERVE);
+    p = put_text(p, "{\"type\":\"");
+    p = put_text(p, token_type_name(token->type));
+    p = put_text(p, "\",\"line\":");
+    p = put_decimal(p, token->line);
+    p = put_text(p, ",\"column\":");
+    p = put_decimal(p, token->column);
+    p = put_text(p, ",\"offset\":");
+    p = put_decimal(p, (long long)offset);
+    p = put_text(p, ",\"length\":");
+    p = put_decimal(p, (long long)length);
+    if (token->type == TOKEN_LITNUMERAL) {
+        p = put_text(p, ",\"value\":");
+        p = put_decimal(p, token->int_value);
+    }
+    p = put_text(p, ",\"text\":\"");
+    output->length = (size_t)(p - output->data);
+    
+    append_json_string(output, text, length);
+    
+    if (error != NULL) {
+        output_append(output, "\",\"error\":\"", 11);
+        append_json_string(output, error, strlen(error));
+    }
+    output_append(output, "\"}\n", 3);
+}
+
+// ==================== RECORRIDO ====================
+
+int token_stream_write(const char* source, size_t length, TokenStreamFormat format,
+                       FILE* out) {
+    Output output;
+    output.data = (char*)malloc(OUTPUT_BUFFER_SIZE);
+    output.length = 0;
+    output.out = out;
+    output.failed = 0;
+    if (output.data == NULL) return 2;
+    
+    if (format == TOKEN_STREAM_BINARY) {
+        write_binary_header(&output);
+    }
+    
+    Lexer lexer;
+    lexer_init(&lexer, source);
+    lexer.padded = 1;
+    lexer.end = source + length;
+    int had_error = 0;
+    
+    for (;;) {
+        // Modo descarte: el texto del token se toma directamente del fuente
+        Token token = lexer_skip_token(&lexer);
+        size_t offset = (size_t)(token.start - source);
+        size_t token_length = (size_t)token.length;
+        
+        const char* error = NULL;
+        if (token.type == TOKEN_ERROR) {
+            error = lexer.error_message;
+            had_error = 1;
+        }
+        
+        if (format == TOKEN_STREAM_BINARY) {
+            write_binary_record(&output, &token, offset, token_length);
+        } else {
+            write_json_record(&output, &token, token.start, offset, token_length, error);
+        }
+        
+        if (token.type == TOKEN_EOF) break;
+    }
+    
+    output_flush(&output);
+    free(output.data);
+    
+    if (output.failed || fflush(out) != 0) return 2;
+    return had_error;
+}
@@ -0,0 +1,43 @@
+#ifndef TOKEN_STREAM_H
+#define TOKEN_STREAM_H
+
+#include <stdio.h>
+
+// Salida del flujo de tokens para --lex-only: solo el lexer, sin parser.
+//
+// Los tokens se escanean en modo descarte (sin reservar memoria por
+// token) y se escriben en un buffer grande que se vuelca con fwrite. El
+// texto de cada token es el rango [offset, offset + length) del fuente.
+//
+// Formato JSON (una linea por token):
+//   {"type":"ID","line":3,"column":5,"offset":12,"length":3,"text":"x"}
+//   Los numerales agregan "value" y los errores "error" con el mensaje.
+//   La salida siempre es UTF-8 válido: los bytes que no forman UTF-8
+//   (un fuente en Latin-1) se escriben como \u00XX.
+//
+// Formato binario (little-endian):
+//   cabecera de TOKEN_STREAM_HEADER_SIZE bytes:
+//     "M0TS", version (u32), tamaño de registro (u32), reservado (u32)
+//   un registro de TOKEN_STREAM_RECORD_SIZE bytes por token:
+//     tipo (u8), 3 bytes en cero, offset (u32), length (u32),
+//     line (u32), column (u32), valor del numeral (i32)
+//
+// En ambos formatos el ultimo registro es el token EOF.
+
+#define TOKEN_STREAM_VERSION 1
+#define TOKEN_STREAM_HEADER_SIZE 16
+#define TOKEN_STREAM_RECORD_SIZE 24
+
+typedef enum {
+    TOKEN_STREAM_JSON,
+    TOKEN_STREAM_BINARY
+} TokenStreamFormat;
+
+// Escribir todos los tokens de 'source' ('length' bytes de read_file: con
+// SIMD_PAD bytes después del '\0') en 'out'. Retorna 0 si no hubo
+// errores lexicos, 1 si los hubo (los errores tambien se escriben como
+// tokens ERROR) y 2 si fallo la escritura.
+int token_stream_write(const char* source, size_t length, TokenStreamFormat format,
+                       FILE* out);
+
+#endif
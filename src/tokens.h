@@ -58,7 +58,9 @@ typedef enum {
 
 typedef struct {
     TokenType type;
-    char* lexeme;       // Texto del token
+    char* lexeme;       // Texto del token (copia; NULL en modo descarte)
+    const char* start;  // Texto del token dentro del fuente, sin copiar
+    int length;         // Longitud de ese texto
     int line;           // Línea donde aparece
     int column;         // Columna donde aparece
     
@@ -0,0 +1,55 @@
+#!/bin/sh
+# Compara --batch con el análisis de cada archivo por separado.
+#
+# Para cada cargador, la salida de --batch sobre tests/valid y
+# tests/invalid debe ser la de ejecutar mini0parser con cada archivo, con
+# la ruta como prefijo de cada línea (stdout y stderr por separado), más
+# la línea de resumen al final de stdout. El código de salida debe ser 1
+# (hay archivos con errores).
+#
+# Uso (desde la raíz del repositorio): tests/test_batch.sh [mini0parser]
+set -e
+
+BIN=${1:-./mini0parser}
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+count=0
+failed=0
+for file in tests/valid/*.mini0 tests/invalid/*.mini0; do
+    echo "$file" >> "$WORK/list.txt"
+    status=0
+    "$BIN" "$file" > "$WORK/out" 2> "$WORK/err" || status=$?
+    sed "s|^|$file: |" "$WORK/out" >> "$WORK/expected_out"
+    sed "s|^|$file: |" "$WORK/err" >> "$WORK/expected_err"
+    count=$((count + 1))
+    [ $status -eq 0 ] || failed=$((failed + 1))
+done
+echo "$count archivos analizados: $((count - failed)) correctos, $failed con errores" \
+    >> "$WORK/expected_out"
+
+result=0
+for loader in uring threads sync; do
+    status=0
+    "$BIN" --batch "$WORK/list.txt" --loader $loader \
+        > "$WORK/batch_out" 2> "$WORK/batch_err" || status=$?
+    
+    if [ $status -ne 1 ]; then
+        echo "test_batch: --loader $loader termino con $status (se esperaba 1)"
+        result=1
+    fi
+    if ! cmp -s "$WORK/expected_out" "$WORK/batch_out"; then
+        echo "test_batch: stdout de --loader $loader difiere:"
+        diff "$WORK/expected_out" "$WORK/batch_out" || true
+        result=1
+    fi
+    if ! cmp -s "$WORK/expected_err" "$WORK/batch_err"; then
+        echo "test_batch: stderr de --loader $loader difiere:"
+        diff "$WORK/expected_err" "$WORK/batch_err" || true
+        result=1
+    fi
+done
+
+[ $result -eq 0 ] && echo "test_batch: OK ($count archivos, 3 cargadores)"
+exit $result
@@ -0,0 +1,152 @@
+// test_loader.c
+// Prueba del camino de error de io_uring en src/loader.c: se compila con
+// -DLOADER_FAULT_ENTER=N para que el envío número N falle a mitad de la
+// carga. Verifica que cada archivo se entregue una sola vez y con el mismo
+// contenido que read_file, y que no queden descriptores ni mapeos del
+// anillo abiertos.
+//
+// Uso: test_loader <archivo.mini0>...
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../src/loader.h"
+#include "../src/source.h"
+
+#ifndef LOADER_FAULT_ENTER
+#error "Compilar con -DLOADER_FAULT_ENTER=<n> (ver README)"
+#endif
+
+// Más rutas que LOADER_URING_DEPTH para que haya archivos en vuelo y
+// pendientes cuando falla el envío
+#define TEST_PATH_COUNT 300
+#define TEST_MISSING_PATH "tests/no_existe.mini0"
+
+typedef struct {
+    char** paths;
+    char** expected;
+    size_t* expected_length;
+    int* delivered;
+    int failures;
+} TestState;
+
+static void deliver(void* context, LoadedFile* file) {
+    TestState* state = (TestState*)context;
+    int index = file->index;
+    state->delivered[index]++;
+    
+    if (state->expected[index] == NULL) {
+        if (file->status != LOAD_OPEN_FAILED) {
+            fprintf(stderr, "test_loader: '%s' deberia fallar al abrir\n", state->paths[index]);
+            state->failures++;
+        }
+    } else if (file->status != LOAD_OK ||
+               file->length != state->expected_length[index] ||
+               memcmp(file->data, state->expected[index], file->length) != 0 ||
+               file->data[file->length] != '\0') {
+        fprintf(stderr, "test_loader: contenido distinto en '%s'\n", state->paths[index]);
+        state->failures++;
+    }
+    free(file->data);
+}
+
+static int count_open_fds(void) {
+    DIR* dir = opendir("/proc/self/fd");
+    if (dir == NULL) return -1;
+    
+    int count = 0;
+    while (readdir(dir) != NULL) count++;
+    closedir(dir);
+    return count;
+}
+
+static int count_ring_maps(void) {
+    FILE* maps = fopen("/proc/self/maps", "r");
+    if (maps == NULL) return -1;
+    
+    char line[512];
+    int count = 0;
+    while (fgets(line, sizeof(line), maps) != NULL) {
+        if (strstr(line, "io_uring") != NULL) count++;
+    }
+    fclose(maps);
+    return count;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Uso: %s <archivo.mini0>...\n", argv[0]);
+        return 1;
+    }
+    
+    int files = argc - 1;
+    char** contents = (char**)calloc((size_t)files, sizeof(char*));
+    size_t* lengths = (size_t*)calloc((size_t)files, sizeof(size_t));
+    for (int i = 0; i < files; i++) {
+        contents[i] = read_file(argv[i + 1], &lengths[i]);
+        if (contents[i] == NULL) return 1;
+    }
+    
+    TestState state;
+    state.paths = (char**)malloc(sizeof(char*) * TEST_PATH_COUNT);
+    state.expected = (char**)malloc(sizeof(char*) * TEST_PATH_COUNT);
+    state.expected_length = (size_t*)malloc(sizeof(size_t) * TEST_PATH_COUNT);
+    state.delivered = (int*)calloc(TEST_PATH_COUNT, sizeof(int));
+    state.failures = 0;
+    
+    // Las rutas de entrada repetidas, con una ruta inexistente cada 50
+    for (int i = 0; i < TEST_PATH_COUNT; i++) {
+        if (i % 50 == 49) {
+            state.paths[i] = (char*)TEST_MISSING_PATH;
+            state.expected[i] = NULL;
+            state.expected_length[i] = 0;
+        } else {
+            state.paths[i] = argv[1 + i % files];
+            state.expected[i] = contents[i % files];
+            state.expected_length[i] = lengths[i % files];
+        }
+    }
+    
+    int fds_before = count_open_fds();
+    int maps_before = count_ring_maps();
+    
+    LoaderKind used = loader_run(LOADER_URING, state.paths, TEST_PATH_COUNT, deliver, &state);
+    
+    for (int i = 0; i < TEST_PATH_COUNT; i++) {
+        if (state.delivered[i] != 1) {
+            fprintf(stderr, "test_loader: '%s' (posicion %d) entregado %d veces\n",
+                    state.paths[i], i, state.delivered[i]);
+            state.failures++;
+        }
+    }
+    
+    int fds_after = count_open_fds();
+    int maps_after = count_ring_maps();
+    if (fds_after != fds_before) {
+        fprintf(stderr, "test_loader: descriptores abiertos: %d antes, %d despues\n",
+                fds_before, fds_after);
+        state.failures++;
+    }
+    if (maps_after != maps_before) {
+        fprintf(stderr, "test_loader: mapeos de io_uring: %d antes, %d despues\n",
+                maps_before, maps_after);
+        state.failures++;
+    }
+    
+    if (used != LOADER_URING) {
+        printf("test_loader: io_uring no disponible (se uso %s); no se probo el fallo\n",
+               loader_name(used));
+    } else if (state.failures == 0) {
+        printf("test_loader: OK (%d archivos, fallo en el envio %d)\n",
+               TEST_PATH_COUNT, LOADER_FAULT_ENTER);
+    }
+    
+    for (int i = 0; i < files; i++) free(contents[i]);
+    free(contents);
+    free(lengths);
+    free(state.paths);
+    free(state.expected);
+    free(state.expected_length);
+    free(state.delivered);
+    return state.failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+# Genera src/lexer_tables.h: clases de caracteres y transiciones del DFA
+# del lexer. Uso: python3 tools/gen_lexer_tables.py > src/lexer_tables.h
+
+# Clases de caracteres (indice = valor en char_class[])
+CLASSES = [
+    "C_OTHER", "C_NUL", "C_WS", "C_NL", "C_QUOTE", "C_ALPHA", "C_HEXALPHA",
+    "C_X", "C_ZERO", "C_DIGIT", "C_LT", "C_GT", "C_EQ", "C_LPAREN",
+    "C_RPAREN", "C_LBRACKET", "C_RBRACKET", "C_COMMA", "C_COLON", "C_PLUS",
+    "C_MINUS", "C_STAR", "C_SLASH",
+]
+
+# Estados del DFA y token que aceptan (None = no aceptador)
+STATES = [
+    ("S_STOP", None),
+    ("S_START", None),
+    ("S_ID", "TOKEN_ID"),
+    ("S_ZERO", "TOKEN_LITNUMERAL"),
+    ("S_DEC", "TOKEN_LITNUMERAL"),
+    ("S_HEX_PREFIX", None),
+    ("S_HEX", "TOKEN_LITNUMERAL"),
+    ("S_LT", "TOKEN_LT"),
+    ("S_GT", "TOKEN_GT"),
+    ("S_LE", "TOKEN_LE"),
+    ("S_GE", "TOKEN_GE"),
+    ("S_NE", "TOKEN_NE"),
+    ("S_EQ", "TOKEN_EQ"),
+    ("S_LPAREN", "TOKEN_LPAREN"),
+    ("S_RPAREN", "TOKEN_RPAREN"),
+    ("S_LBRACKET", "TOKEN_LBRACKET"),
+    ("S_RBRACKET", "TOKEN_RBRACKET"),
+    ("S_COMMA", "TOKEN_COMMA"),
+    ("S_COLON", "TOKEN_COLON"),
+    ("S_PLUS", "TOKEN_PLUS"),
+    ("S_MINUS", "TOKEN_MINUS"),
+    ("S_STAR", "TOKEN_STAR"),
+    ("S_SLASH", "TOKEN_SLASH"),
+]
+
+# Base numerica con la que cada estado acumula el valor del literal
+RADIX = {"S_ZERO": 0, "S_DEC": 10, "S_HEX_PREFIX": 0, "S_HEX": 16}
+
+SINGLE = {
+    "C_EQ": "S_EQ", "C_LPAREN": "S_LPAREN", "C_RPAREN": "S_RPAREN",
+    "C_LBRACKET": "S_LBRACKET", "C_RBRACKET": "S_RBRACKET",
+    "C_COMMA": "S_COMMA", "C_COLON": "S_COLON", "C_PLUS": "S_PLUS",
+    "C_MINUS": "S_MINUS", "C_STAR": "S_STAR", "C_SLASH": "S_SLASH",
+}
+
+IDENT = ["C_ALPHA", "C_HEXALPHA", "C_X", "C_ZERO", "C_DIGIT"]
+
+
+def char_class(c):
+    ch = chr(c)
+    if c == 0:
+        return "C_NUL"
+    if ch in " \t\r":
+        return "C_WS"
+    if ch == "\n":
+        return "C_NL"
+    if ch == '"':
+        return "C_QUOTE"
+    if ch in "xX":
+        return "C_X"
+    if ch in "abcdefABCDEF":
+        return "C_HEXALPHA"
+    if ch.isascii() and (ch.isalpha() or ch == "_"):
+        return "C_ALPHA"
+    if ch == "0":
+        return "C_ZERO"
+    if ch.isascii() and ch.isdigit():
+        return "C_DIGIT"
+    return {
+        "<": "C_LT", ">": "C_GT", "=": "C_EQ", "(": "C_LPAREN",
+        ")": "C_RPAREN", "[": "C_LBRACKET", "]": "C_RBRACKET",
+        ",": "C_COMMA", ":": "C_COLON", "+": "C_PLUS", "-": "C_MINUS",
+        "*": "C_STAR", "/": "C_SLASH",
+    }.get(ch, "C_OTHER")
+
+
+def digit_value(c):
+    ch = chr(c)
+    if ch.isascii() and ch.isdigit():
+        return c - ord("0")
+    if ch in "abcdef":
+        return c - ord("a") + 10
+    if ch in "ABCDEF":
+        return c - ord("A") + 10
+    return 0
+
+
+def transitions():
+    table = {name: {} for name, _ in STATES}
+    start = table["S_START"]
+    for cls in ("C_ALPHA", "C_HEXALPHA", "C_X"):
+        start[cls] = "S_ID"
+    start["C_ZERO"] = "S_ZERO"
+    start["C_DIGIT"] = "S_DEC"
+    start["C_LT"] = "S_LT"
+    start["C_GT"] = "S_GT"
+    start.update(SINGLE)
+    for cls in IDENT:
+        table["S_ID"][cls] = "S_ID"
+    table["S_ZERO"]["C_ZERO"] = "S_DEC"
+    table["S_ZERO"]["C_DIGIT"] = "S_DEC"
+    table["S_ZERO"]["C_X"] = "S_HEX_PREFIX"
+    table["S_DEC"]["C_ZERO"] = "S_DEC"
+    table["S_DEC"]["C_DIGIT"] = "S_DEC"
+    for cls in ("C_ZERO", "C_DIGIT", "C_HEXALPHA"):
+        table["S_HEX_PREFIX"][cls] = "S_HEX"
+        table["S_HEX"][cls] = "S_HEX"
+    table["S_LT"]["C_EQ"] = "S_LE"
+    table["S_LT"]["C_GT"] = "S_NE"
+    table["S_GT"]["C_EQ"] = "S_GE"
+    return table
+
+
+def rows(values, per_row, width):
+    out = []
+    for i in range(0, len(values), per_row):
+        out.append("    " + ", ".join(str(v).rjust(width) for v in values[i:i + per_row]) + ",")
+    return "\n".join(out)
+
+
+def main():
+    print("// lexer_tables.h")
+    print("// Generado por tools/gen_lexer_tables.py. No editar a mano.")
+    print("#ifndef LEXER_TABLES_H")
+    print("#define LEXER_TABLES_H")
+    print()
+    print('#include "tokens.h"')
+    print()
+    print("// Clases de caracteres")
+    print("enum {")
+    for i, name in enumerate(CLASSES):
+        print(f"    {name} = {i},")
+    print(f"    CHAR_CLASS_COUNT = {len(CLASSES)}")
+    print("};")
+    print()
+    print("// Estados del DFA (S_STOP = sin transicion)")
+    print("enum {")
+    for i, (name, _) in enumerate(STATES):
+        print(f"    {name} = {i},")
+    print(f"    DFA_STATE_COUNT = {len(STATES)}")
+    print("};")
+    print()
+    print("// Clase de cada byte (ASCII; bytes >= 0x80 son C_OTHER)")
+    print("static const unsigned char char_class[256] = {")
+    print(rows([CLASSES.index(char_class(c)) for c in range(256)], 16, 2))
+    print("};")
+    print()
+    print("// Valor de digito de cada byte (0-9, a-f, A-F; 0 para el resto)")
+    print("static const unsigned char digit_value[256] = {")
+    print(rows([digit_value(c) for c in range(256)], 16, 2))
+    print("};")
+    print()
+    table = transitions()
+    print("// Transiciones: dfa_next[estado][clase]")
+    print("static const unsigned char dfa_next[DFA_STATE_COUNT][CHAR_CLASS_COUNT] = {")
+    for name, _ in STATES:
+        row = [table[name].get(cls, "S_STOP") for cls in CLASSES]
+        values = [str([s for s, _ in STATES].index(r)) for r in row]
+        print(f"    /* {name:<13} */ {{" + ", ".join(v.rjust(2) for v in values) + "},")
+    print("};")
+    print()
+    print("// Token aceptado en cada estado (TOKEN_ERROR = no aceptador)")
+    print("static const unsigned char dfa_accept[DFA_STATE_COUNT] = {")
+    for name, token in STATES:
+        print(f"    {(token or 'TOKEN_ERROR') + ',':<19}// {name}")
+    print("};")
+    print()
+    print("// Base con la que cada estado acumula el valor numerico")
+    print("static const unsigned char dfa_radix[DFA_STATE_COUNT] = {")
+    print(rows([RADIX.get(name, 0) for name, _ in STATES], 12, 2))
+    print("};")
+    print()
+    print("#endif")
+
+
+if __name__ == "__main__":
+    main()